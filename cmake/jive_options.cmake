@@ -2,5 +2,8 @@ include_guard()
 
 option(JIVE_BUILD_TEST_RUNNER "Build JIVE's test runner?" OFF)
 option(JIVE_BUILD_DEMO_RUNNER "Build JIVE's demo runner?" OFF)
+option(JIVE_BUILD_VIEW_COMPILER "Build JIVE's view compiler, which compiles view XML into binary views?" OFF)
 option(JIVE_ENABLE_COVERAGE "Generate coverage reports when running tests?" OFF)
 option(JIVE_ENABLE_SANITISERS "Enable ASan, LSan, UBSan?" OFF)
+option(JIVE_ENABLE_PROFILING "Compile JIVE's profiling scopes into the benchmarks?" OFF)
+option(JIVE_ENABLE_INSTRUMENTATION "Count allocations, listeners and objects created by each benchmark iteration?" OFF)
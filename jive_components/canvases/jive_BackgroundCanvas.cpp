@@ -5,37 +5,53 @@ namespace jive
     BackgroundCanvas::BackgroundCanvas()
     {
         setInterceptsMouseClicks(false, false);
+        updateShape();
+        visualStateChanged();
     }
 
-    static void apply(const Fill& fill, juce::Graphics& g, juce::Rectangle<float> bounds)
+    static void apply(const Fill& fill,
+                      GradientCache& gradientCache,
+                      juce::Graphics& g,
+                      juce::Rectangle<float> bounds)
     {
         if (fill.getGradient().has_value())
-            g.setGradientFill(fill.getGradient()->toJuceGradient(bounds));
+            g.setGradientFill(gradientCache.getColourGradient(*fill.getGradient(), bounds));
         else if (fill.getColour().has_value())
             g.setColour(*fill.getColour());
         else
             g.setColour(juce::Colour{});
     }
 
+    [[nodiscard]] static bool isInvisible(const Fill& fill)
+    {
+        return fill.getColour().has_value() && fill.getColour()->isTransparent();
+    }
+
     void BackgroundCanvas::paint(juce::Graphics& g)
     {
-        const auto bounds = getLocalBounds().toFloat();
+        JIVE_PROFILE_SCOPE("BackgroundCanvas::paint");
+        performanceCounters.countPaint();
+
+        if (isInvisible(visualState.background) && (shape->border.isEmpty() || isInvisible(visualState.borderFill)))
+            return;
 
-        g.reduceClipRegion(shape);
+        RenderCache::getInstance()->draw(g,
+                                         visualState,
+                                         getLocalBounds(),
+                                         [this](juce::Graphics& imageGraphics) {
+                                             const auto bounds = getLocalBounds().toFloat();
 
-        const auto backgroundScale = 1.0f - ((borderWidth / 2.0f) / getWidth());
-        apply(background, g, bounds);
-        g.fillPath(shape,
-                   juce::AffineTransform::scale(backgroundScale,
-                                                backgroundScale,
-                                                bounds.getCentreX(),
-                                                bounds.getCentreY()));
+                                             imageGraphics.reduceClipRegion(shape->outline);
 
-        apply(borderFill, g, bounds);
-        g.strokePath(shape,
-                     juce::PathStrokeType{
-                         borderWidth * 2.0f,
-                     });
+                                             apply(visualState.background, backgroundGradient, imageGraphics, bounds);
+                                             imageGraphics.fillPath(shape->background);
+
+                                             if (!shape->border.isEmpty())
+                                             {
+                                                 apply(visualState.borderFill, borderGradient, imageGraphics, bounds);
+                                                 imageGraphics.fillPath(shape->border);
+                                             }
+                                         });
     }
 
     void BackgroundCanvas::resized()
@@ -43,136 +59,124 @@ namespace jive
         updateShape();
     }
 
+    const PerformanceCounters& BackgroundCanvas::getPerformanceCounters() const
+    {
+        return performanceCounters;
+    }
+
+    void BackgroundCanvas::resetPerformanceCounters()
+    {
+        performanceCounters.reset();
+    }
+
     Fill BackgroundCanvas::getFill() const
     {
-        return background;
+        return visualState.background;
     }
 
     void BackgroundCanvas::setFill(const Fill& newFill)
     {
-        if (newFill != background)
-            repaint();
+        if (newFill == visualState.background)
+            return;
 
-        background = newFill;
+        visualState.background = newFill;
+        visualStateChanged();
     }
 
     Fill BackgroundCanvas::getBorderFill() const
     {
-        return borderFill;
+        return visualState.borderFill;
     }
 
     void BackgroundCanvas::setBorderFill(const Fill& newFill)
     {
-        if (newFill != borderFill)
-            repaint();
+        if (newFill == visualState.borderFill)
+            return;
 
-        borderFill = newFill;
+        visualState.borderFill = newFill;
+        visualStateChanged();
     }
 
     float BackgroundCanvas::getBorderWidth() const
     {
-        return borderWidth;
+        return visualState.borderWidth;
     }
 
     void BackgroundCanvas::setBorderWidth(float newWidth)
     {
-        if (!juce::approximatelyEqual(newWidth, borderWidth))
-            updateShape();
+        if (juce::approximatelyEqual(newWidth, visualState.borderWidth))
+            return;
 
-        borderWidth = newWidth;
+        visualState.borderWidth = newWidth;
+        updateShape();
+        visualStateChanged();
     }
 
     BorderRadii<float> BackgroundCanvas::getBorderRadii() const
     {
-        return borderRadii;
+        return visualState.borderRadii;
     }
 
     void BackgroundCanvas::setBorderRadii(BorderRadii<float> newRadii)
     {
-        if (newRadii != borderRadii)
-            updateShape();
+        if (newRadii == visualState.borderRadii)
+            return;
 
-        borderRadii = newRadii;
+        visualState.borderRadii = newRadii;
+        updateShape();
+        visualStateChanged();
     }
 
-    struct CubicBezier
+    void BackgroundCanvas::updateShape()
     {
-        juce::Point<float> start{ 0.0f, 0.0f };
-        juce::Point<float> control1{ 0.0f, 0.0f };
-        juce::Point<float> control2{ 1.0f, 1.0f };
-        juce::Point<float> end{ 1.0f, 1.0f };
-    };
+        const BackgroundShapeCache::Key key{
+            getLocalBounds().toFloat().getBottomRight(),
+            visualState.borderRadii,
+            visualState.borderWidth,
+        };
+        shape = BackgroundShapeCache::getInstance()->getShape(key, std::move(shape));
+    }
 
-    template <typename Arithmetic>
-    [[nodiscard]] static auto limited(BorderRadii<Arithmetic> radii, Arithmetic min, Arithmetic max)
+    std::size_t BackgroundCanvas::getVisualStateHash() const
     {
-        static_assert(std::is_arithmetic<Arithmetic>());
-
-        radii.topLeft = juce::jlimit(min, max, radii.topLeft);
-        radii.topRight = juce::jlimit(min, max, radii.topRight);
-        radii.bottomLeft = juce::jlimit(min, max, radii.bottomLeft);
-        radii.bottomRight = juce::jlimit(min, max, radii.bottomRight);
-
-        return radii;
+        return visualState.getHash();
     }
 
-    static std::array<CubicBezier, 4> getCorners(BorderRadii<float> radii,
-                                                 juce::Rectangle<float> bounds)
+    void BackgroundCanvas::visualStateChanged()
     {
-        static constexpr auto relativeControlPointOffsetForNearPerfectEllipse = 0.552f;
-
-        const auto maxRadius = juce::jmin(bounds.getWidth(), bounds.getHeight()) / 2.0f;
-        radii = limited(radii, 0.0f, maxRadius);
-
-        CubicBezier topLeft;
-        topLeft.start = bounds.getTopLeft().translated(0.0f, radii.topLeft);
-        topLeft.control1 = topLeft.start.translated(0.0f, -radii.topLeft * relativeControlPointOffsetForNearPerfectEllipse);
-        topLeft.end = bounds.getTopLeft().translated(radii.topLeft, 0.0f);
-        topLeft.control2 = topLeft.end.translated(-radii.topLeft * relativeControlPointOffsetForNearPerfectEllipse, 0.0f);
-
-        CubicBezier topRight;
-        topRight.start = bounds.getTopRight().translated(-radii.topRight, 0.0f);
-        topRight.control1 = topRight.start.translated(radii.topRight * relativeControlPointOffsetForNearPerfectEllipse, 0.0f);
-        topRight.end = bounds.getTopRight().translated(0.0f, radii.topRight);
-        topRight.control2 = topRight.end.translated(0.0f, -radii.topRight * relativeControlPointOffsetForNearPerfectEllipse);
-
-        CubicBezier bottomRight;
-        bottomRight.start = bounds.getBottomRight().translated(0.0f, -radii.bottomRight);
-        bottomRight.control1 = bottomRight.start.translated(0.0f, radii.bottomRight * relativeControlPointOffsetForNearPerfectEllipse);
-        bottomRight.end = bounds.getBottomRight().translated(-radii.bottomRight, 0.0f);
-        bottomRight.control2 = bottomRight.end.translated(radii.bottomRight * relativeControlPointOffsetForNearPerfectEllipse, 0.0f);
-
-        CubicBezier bottomLeft;
-        bottomLeft.start = bounds.getBottomLeft().translated(radii.bottomLeft, 0.0f);
-        bottomLeft.control1 = bottomLeft.start.translated(-radii.bottomLeft * relativeControlPointOffsetForNearPerfectEllipse, 0.0f);
-        bottomLeft.end = bounds.getBottomLeft().translated(0.0f, -radii.bottomLeft);
-        bottomLeft.control2 = bottomLeft.end.translated(0.0f, radii.bottomLeft * relativeControlPointOffsetForNearPerfectEllipse);
-
-        return {
-            topLeft,
-            topRight,
-            bottomRight,
-            bottomLeft,
-        };
+        // The setters only get here when their value actually changed
+        visualState.hash = hashAll(visualState.background,
+                                   visualState.borderFill,
+                                   visualState.borderWidth,
+                                   visualState.borderRadii.topLeft,
+                                   visualState.borderRadii.topRight,
+                                   visualState.borderRadii.bottomRight,
+                                   visualState.borderRadii.bottomLeft);
+        repaint();
     }
 
-    void BackgroundCanvas::updateShape()
+    bool BackgroundCanvas::VisualState::operator==(const VisualState& other) const
     {
-        shape.clear();
-
-        for (const auto& corner : getCorners(getBorderRadii(),
-                                             getLocalBounds().toFloat()))
-        {
-            if (shape.isEmpty())
-                shape.startNewSubPath(corner.start);
-            else
-                shape.lineTo(corner.start);
+        return hash == other.hash
+            && background == other.background
+            && borderFill == other.borderFill
+            && juce::exactlyEqual(borderWidth, other.borderWidth)
+            && borderRadii == other.borderRadii;
+    }
 
-            shape.cubicTo(corner.control1, corner.control2, corner.end);
-        }
+    std::size_t BackgroundCanvas::VisualState::getHash() const
+    {
+        return hash;
+    }
 
-        shape.closeSubPath();
+    bool BackgroundCanvas::VisualState::isSameAs(const RenderCache::VisualState& other) const
+    {
+        const auto* otherState = dynamic_cast<const VisualState*>(&other);
+        return otherState != nullptr && *this == *otherState;
+    }
 
-        repaint();
+    std::unique_ptr<RenderCache::VisualState> BackgroundCanvas::VisualState::clone() const
+    {
+        return std::make_unique<VisualState>(*this);
     }
 } // namespace jive
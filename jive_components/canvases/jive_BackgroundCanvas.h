@@ -1,5 +1,8 @@
 #pragma once
 
+#include "jive_BackgroundShapeCache.h"
+#include "jive_RenderCache.h"
+
 #include <jive_components/accessibility/jive_IgnoredComponent.h>
 
 #include <jive_core/jive_core.h>
@@ -24,15 +27,39 @@ namespace jive
         BorderRadii<float> getBorderRadii() const;
         void setBorderRadii(BorderRadii<float> radii);
 
+        /** Returns a hash of everything that affects what this canvas paints. */
+        [[nodiscard]] std::size_t getVisualStateHash() const;
+
+        [[nodiscard]] const PerformanceCounters& getPerformanceCounters() const;
+        void resetPerformanceCounters();
+
     private:
+        struct VisualState final : RenderCache::VisualState
+        {
+            [[nodiscard]] bool operator==(const VisualState& other) const;
+
+            [[nodiscard]] std::size_t getHash() const final;
+            [[nodiscard]] bool isSameAs(const RenderCache::VisualState& other) const final;
+            [[nodiscard]] std::unique_ptr<RenderCache::VisualState> clone() const final;
+
+            Fill background{ juce::Colours::transparentBlack };
+            Fill borderFill{ juce::Colours::transparentBlack };
+            float borderWidth{ 0.0f };
+            BorderRadii<float> borderRadii;
+            std::size_t hash{ 0 };
+        };
+
         void updateShape();
+        void visualStateChanged();
+
+        VisualState visualState;
+
+        GradientCache backgroundGradient;
+        GradientCache borderGradient;
 
-        Fill background{ juce::Colours::transparentBlack };
-        Fill borderFill{ juce::Colours::transparentBlack };
-        float borderWidth{ 0.0f };
-        BorderRadii<float> borderRadii;
+        BackgroundShapeCache::SharedShape shape;
 
-        juce::Path shape;
+        PerformanceCounters performanceCounters;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BackgroundCanvas)
     };
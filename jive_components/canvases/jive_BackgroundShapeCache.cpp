@@ -0,0 +1,278 @@
+#include "jive_BackgroundShapeCache.h"
+
+namespace jive
+{
+    bool BackgroundShapeCache::Key::operator==(const Key& other) const
+    {
+        return juce::exactlyEqual(size.x, other.size.x)
+            && juce::exactlyEqual(size.y, other.size.y)
+            && juce::exactlyEqual(radii.topLeft, other.radii.topLeft)
+            && juce::exactlyEqual(radii.topRight, other.radii.topRight)
+            && juce::exactlyEqual(radii.bottomRight, other.radii.bottomRight)
+            && juce::exactlyEqual(radii.bottomLeft, other.radii.bottomLeft)
+            && juce::exactlyEqual(borderWidth, other.borderWidth);
+    }
+
+    bool BackgroundShapeCache::Key::operator!=(const Key& other) const
+    {
+        return !(*this == other);
+    }
+
+    std::size_t BackgroundShapeCache::KeyHash::operator()(const Key& key) const noexcept
+    {
+        return hashAll(key.size.x,
+                       key.size.y,
+                       key.radii.topLeft,
+                       key.radii.topRight,
+                       key.radii.bottomRight,
+                       key.radii.bottomLeft,
+                       key.borderWidth);
+    }
+
+    struct CubicBezier
+    {
+        juce::Point<float> start{ 0.0f, 0.0f };
+        juce::Point<float> control1{ 0.0f, 0.0f };
+        juce::Point<float> control2{ 1.0f, 1.0f };
+        juce::Point<float> end{ 1.0f, 1.0f };
+    };
+
+    template <typename Arithmetic>
+    [[nodiscard]] static auto limited(BorderRadii<Arithmetic> radii, Arithmetic min, Arithmetic max)
+    {
+        static_assert(std::is_arithmetic<Arithmetic>());
+
+        radii.topLeft = juce::jlimit(min, max, radii.topLeft);
+        radii.topRight = juce::jlimit(min, max, radii.topRight);
+        radii.bottomLeft = juce::jlimit(min, max, radii.bottomLeft);
+        radii.bottomRight = juce::jlimit(min, max, radii.bottomRight);
+
+        return radii;
+    }
+
+    static std::array<CubicBezier, 4> getCorners(BorderRadii<float> radii,
+                                                 juce::Rectangle<float> bounds)
+    {
+        static constexpr auto relativeControlPointOffsetForNearPerfectEllipse = 0.552f;
+
+        const auto maxRadius = juce::jmin(bounds.getWidth(), bounds.getHeight()) / 2.0f;
+        radii = limited(radii, 0.0f, maxRadius);
+
+        CubicBezier topLeft;
+        topLeft.start = bounds.getTopLeft().translated(0.0f, radii.topLeft);
+        topLeft.control1 = topLeft.start.translated(0.0f, -radii.topLeft * relativeControlPointOffsetForNearPerfectEllipse);
+        topLeft.end = bounds.getTopLeft().translated(radii.topLeft, 0.0f);
+        topLeft.control2 = topLeft.end.translated(-radii.topLeft * relativeControlPointOffsetForNearPerfectEllipse, 0.0f);
+
+        CubicBezier topRight;
+        topRight.start = bounds.getTopRight().translated(-radii.topRight, 0.0f);
+        topRight.control1 = topRight.start.translated(radii.topRight * relativeControlPointOffsetForNearPerfectEllipse, 0.0f);
+        topRight.end = bounds.getTopRight().translated(0.0f, radii.topRight);
+        topRight.control2 = topRight.end.translated(0.0f, -radii.topRight * relativeControlPointOffsetForNearPerfectEllipse);
+
+        CubicBezier bottomRight;
+        bottomRight.start = bounds.getBottomRight().translated(0.0f, -radii.bottomRight);
+        bottomRight.control1 = bottomRight.start.translated(0.0f, radii.bottomRight * relativeControlPointOffsetForNearPerfectEllipse);
+        bottomRight.end = bounds.getBottomRight().translated(-radii.bottomRight, 0.0f);
+        bottomRight.control2 = bottomRight.end.translated(radii.bottomRight * relativeControlPointOffsetForNearPerfectEllipse, 0.0f);
+
+        CubicBezier bottomLeft;
+        bottomLeft.start = bounds.getBottomLeft().translated(radii.bottomLeft, 0.0f);
+        bottomLeft.control1 = bottomLeft.start.translated(-radii.bottomLeft * relativeControlPointOffsetForNearPerfectEllipse, 0.0f);
+        bottomLeft.end = bounds.getBottomLeft().translated(0.0f, -radii.bottomLeft);
+        bottomLeft.control2 = bottomLeft.end.translated(0.0f, radii.bottomLeft * relativeControlPointOffsetForNearPerfectEllipse);
+
+        return {
+            topLeft,
+            topRight,
+            bottomRight,
+            bottomLeft,
+        };
+    }
+
+    static void buildPaths(BackgroundShapeCache::Shape& shape)
+    {
+        const juce::Rectangle<float> bounds{ shape.key.size.x, shape.key.size.y };
+
+        shape.outline.clear();
+
+        for (const auto& corner : getCorners(shape.key.radii, bounds))
+        {
+            if (shape.outline.isEmpty())
+                shape.outline.startNewSubPath(corner.start);
+            else
+                shape.outline.lineTo(corner.start);
+
+            shape.outline.cubicTo(corner.control1, corner.control2, corner.end);
+        }
+
+        shape.outline.closeSubPath();
+
+        const auto backgroundScale = bounds.getWidth() > 0.0f
+                                       ? 1.0f - ((shape.key.borderWidth / 2.0f) / bounds.getWidth())
+                                       : 1.0f;
+        shape.background.clear();
+        shape.background.addPath(shape.outline,
+                                 juce::AffineTransform::scale(backgroundScale,
+                                                              backgroundScale,
+                                                              bounds.getCentreX(),
+                                                              bounds.getCentreY()));
+
+        shape.border.clear();
+
+        if (shape.key.borderWidth > 0.0f)
+        {
+            juce::PathStrokeType{ shape.key.borderWidth * 2.0f }
+                .createStrokedPath(shape.border, shape.outline);
+        }
+    }
+
+    BackgroundShapeCache::~BackgroundShapeCache()
+    {
+        clearSingletonInstance();
+    }
+
+    BackgroundShapeCache::SharedShape BackgroundShapeCache::getShape(const Key& key, SharedShape previous)
+    {
+        if (previous != nullptr && previous->key == key)
+            return previous;
+
+        const auto previousIsUnique = previous != nullptr && previous.use_count() == 1;
+
+        if (previousIsUnique)
+            shapes.erase(previous->key);
+
+        if (const auto existing = shapes.find(key);
+            existing != std::end(shapes))
+        {
+            if (auto shape = existing->second.lock())
+                return shape;
+        }
+
+        auto shape = previousIsUnique
+                       ? std::const_pointer_cast<Shape>(std::move(previous))
+                       : std::make_shared<Shape>();
+        shape->key = key;
+        buildPaths(*shape);
+
+        if (std::size(shapes) >= nextPruneSize)
+            removeExpiredShapes();
+
+        shapes[key] = shape;
+        return shape;
+    }
+
+    int BackgroundShapeCache::getNumCachedShapes() const
+    {
+        return static_cast<int>(std::count_if(std::begin(shapes),
+                                              std::end(shapes),
+                                              [](const auto& entry) {
+                                                  return !entry.second.expired();
+                                              }));
+    }
+
+    void BackgroundShapeCache::removeExpiredShapes()
+    {
+        for (auto entry = std::begin(shapes); entry != std::end(shapes);)
+        {
+            if (entry->second.expired())
+                entry = shapes.erase(entry);
+            else
+                entry++;
+        }
+
+        nextPruneSize = juce::jmax(minimumPruneSize, std::size(shapes) * 2);
+    }
+
+    JUCE_IMPLEMENT_SINGLETON(BackgroundShapeCache)
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class BackgroundShapeCacheTest : public juce::UnitTest
+{
+public:
+    BackgroundShapeCacheTest()
+        : juce::UnitTest{ "jive::BackgroundShapeCache", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSharing();
+        testReuse();
+        testExpiry();
+    }
+
+private:
+    void testSharing()
+    {
+        beginTest("sharing");
+
+        jive::BackgroundShapeCache cache;
+        const jive::BackgroundShapeCache::Key key{
+            { 100.0f, 30.0f },
+            jive::BorderRadii<float>{ 5.0f },
+            2.0f,
+        };
+
+        const auto first = cache.getShape(key);
+        const auto second = cache.getShape(key);
+        expect(first == second);
+        expectEquals(cache.getNumCachedShapes(), 1);
+        expect(!first->outline.isEmpty());
+        expect(!first->border.isEmpty());
+
+        auto otherKey = key;
+        otherKey.borderWidth = 0.0f;
+        const auto third = cache.getShape(otherKey);
+        expect(third != first);
+        expect(third->border.isEmpty());
+        expectEquals(cache.getNumCachedShapes(), 2);
+    }
+
+    void testReuse()
+    {
+        beginTest("reusing unshared shapes");
+
+        jive::BackgroundShapeCache cache;
+        jive::BackgroundShapeCache::Key key{
+            { 100.0f, 30.0f },
+            jive::BorderRadii<float>{ 5.0f },
+            0.0f,
+        };
+
+        auto shape = cache.getShape(key);
+        const auto* const address = shape.get();
+
+        key.size = { 110.0f, 35.0f };
+        shape = cache.getShape(key, std::move(shape));
+        expect(shape.get() == address);
+        expect(shape->key == key);
+        expectEquals(shape->outline.getBounds(), juce::Rectangle<float>{ 110.0f, 35.0f });
+        expectEquals(cache.getNumCachedShapes(), 1);
+
+        const auto sharedCopy = shape;
+        key.size = { 120.0f, 40.0f };
+        shape = cache.getShape(key, std::move(shape));
+        expect(shape.get() != address);
+        expectEquals(sharedCopy->outline.getBounds(), juce::Rectangle<float>{ 110.0f, 35.0f });
+        expectEquals(cache.getNumCachedShapes(), 2);
+    }
+
+    void testExpiry()
+    {
+        beginTest("expiry");
+
+        jive::BackgroundShapeCache cache;
+
+        {
+            const auto shape = cache.getShape({ { 10.0f, 10.0f }, {}, 0.0f });
+            expectEquals(cache.getNumCachedShapes(), 1);
+        }
+
+        expectEquals(cache.getNumCachedShapes(), 0);
+    }
+};
+
+static BackgroundShapeCacheTest backgroundShapeCacheTest;
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    /** A process-wide store of the rounded-rectangle geometry painted by
+        BackgroundCanvas.
+
+        Canvases with the same size, border radii and border width share a
+        single immutable Shape, so a view with thousands of identical buttons
+        only ever builds and strokes one set of paths.
+    */
+    class BackgroundShapeCache : private juce::DeletedAtShutdown
+    {
+    public:
+        struct Key
+        {
+            [[nodiscard]] bool operator==(const Key& other) const;
+            [[nodiscard]] bool operator!=(const Key& other) const;
+
+            juce::Point<float> size;
+            BorderRadii<float> radii;
+            float borderWidth{ 0.0f };
+        };
+
+        struct Shape
+        {
+            Key key;
+
+            juce::Path outline;
+            juce::Path background;
+            juce::Path border;
+        };
+
+        using SharedShape = std::shared_ptr<const Shape>;
+
+        BackgroundShapeCache() = default;
+        ~BackgroundShapeCache() override;
+
+        /** Returns the shape for the given key, building it if no other
+            canvas is currently holding one.
+
+            If the caller passes in the shape it previously used and nobody
+            else is sharing it, that shape's paths are rebuilt in-place so
+            that resize animations don't reallocate path storage every frame.
+        */
+        [[nodiscard]] SharedShape getShape(const Key& key, SharedShape previous = nullptr);
+
+        [[nodiscard]] int getNumCachedShapes() const;
+
+        JUCE_DECLARE_SINGLETON(BackgroundShapeCache, false)
+
+    private:
+        struct KeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const Key& key) const noexcept;
+        };
+
+        void removeExpiredShapes();
+
+        std::unordered_map<Key, std::weak_ptr<const Shape>, KeyHash> shapes;
+        std::size_t nextPruneSize{ minimumPruneSize };
+
+        static constexpr std::size_t minimumPruneSize = 64;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BackgroundShapeCache)
+    };
+} // namespace jive
@@ -0,0 +1,301 @@
+#include "jive_RenderCache.h"
+
+namespace jive
+{
+    bool RenderCache::Key::operator==(const Key& other) const
+    {
+        return width == other.width
+            && height == other.height
+            && juce::exactlyEqual(scale, other.scale)
+            && visualState->isSameAs(*other.visualState);
+    }
+
+    std::size_t RenderCache::KeyHash::operator()(const Key& key) const noexcept
+    {
+        return hashAll(key.visualState->getHash(), key.width, key.height, key.scale);
+    }
+
+    [[nodiscard]] static juce::Point<int> getScaledImageSize(int width, int height, float scale)
+    {
+        return {
+            juce::jmax(1, juce::roundToInt(static_cast<float>(width) * scale)),
+            juce::jmax(1, juce::roundToInt(static_cast<float>(height) * scale)),
+        };
+    }
+
+    RenderCache::~RenderCache()
+    {
+        clearSingletonInstance();
+    }
+
+    void RenderCache::draw(juce::Graphics& g,
+                           const VisualState& visualState,
+                           juce::Rectangle<int> bounds,
+                           const std::function<void(juce::Graphics&)>& render)
+    {
+        if (bounds.isEmpty())
+            return;
+
+        const Key key{
+            &visualState,
+            bounds.getWidth(),
+            bounds.getHeight(),
+            g.getInternalContext().getPhysicalPixelScaleFactor(),
+        };
+        const auto imageSize = getScaledImageSize(key.width, key.height, key.scale);
+
+        if (static_cast<std::size_t>(imageSize.x) * static_cast<std::size_t>(imageSize.y) * 4 > maximumSizeInBytes)
+        {
+            render(g);
+            return;
+        }
+
+        const auto& image = getImage(key, bounds, render);
+
+        juce::Graphics::ScopedSaveState state{ g };
+        g.setOpacity(1.0f);
+        g.drawImageTransformed(image,
+                               juce::AffineTransform::scale(1.0f / key.scale)
+                                   .translated(bounds.getPosition().toFloat()));
+    }
+
+    std::size_t RenderCache::getMaximumSizeInBytes() const
+    {
+        return maximumSizeInBytes;
+    }
+
+    void RenderCache::setMaximumSizeInBytes(std::size_t newMaximumSize)
+    {
+        maximumSizeInBytes = newMaximumSize;
+        evictUntilWithin(maximumSizeInBytes);
+    }
+
+    std::size_t RenderCache::getSizeInBytes() const
+    {
+        return sizeInBytes;
+    }
+
+    int RenderCache::getNumImages() const
+    {
+        return static_cast<int>(std::size(entries));
+    }
+
+    void RenderCache::clear()
+    {
+        evictUntilWithin(0);
+    }
+
+    const juce::Image& RenderCache::getImage(const Key& key,
+                                             juce::Rectangle<int> bounds,
+                                             const std::function<void(juce::Graphics&)>& render)
+    {
+        if (const auto existing = index.find(key);
+            existing != std::end(index))
+        {
+            entries.splice(std::begin(entries), entries, existing->second);
+            return entries.front().image;
+        }
+
+        const auto imageSize = getScaledImageSize(key.width, key.height, key.scale);
+        juce::Image image{ juce::Image::ARGB, imageSize.x, imageSize.y, true };
+
+        {
+            juce::Graphics imageGraphics{ image };
+            imageGraphics.addTransform(juce::AffineTransform::translation(-bounds.getPosition().toFloat())
+                                           .scaled(key.scale));
+            render(imageGraphics);
+        }
+
+        const auto imageSizeInBytes = static_cast<std::size_t>(imageSize.x) * static_cast<std::size_t>(imageSize.y) * 4;
+        // The stored key refers to the entry's own copy of the state, which
+        // outlives the caller's
+        auto visualState = key.visualState->clone();
+        auto storedKey = key;
+        storedKey.visualState = visualState.get();
+
+        entries.push_front(Entry{ std::move(visualState), storedKey, std::move(image), imageSizeInBytes });
+        index[storedKey] = std::begin(entries);
+        sizeInBytes += imageSizeInBytes;
+
+        evictUntilWithin(maximumSizeInBytes);
+        return entries.front().image;
+    }
+
+    void RenderCache::evictUntilWithin(std::size_t maximumSize)
+    {
+        while (sizeInBytes > maximumSize && !entries.empty())
+        {
+            sizeInBytes -= entries.back().sizeInBytes;
+            index.erase(entries.back().key);
+            entries.pop_back();
+        }
+    }
+
+    JUCE_IMPLEMENT_SINGLETON(RenderCache)
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class RenderCacheTest : public juce::UnitTest
+{
+public:
+    RenderCacheTest()
+        : juce::UnitTest{ "jive::RenderCache", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCaching();
+        testHashCollisions();
+        testEviction();
+        testDisabling();
+    }
+
+private:
+    struct TestState final : jive::RenderCache::VisualState
+    {
+        explicit TestState(int stateValue)
+            : TestState{ stateValue, static_cast<std::size_t>(stateValue) }
+        {
+        }
+
+        TestState(int stateValue, std::size_t stateHash)
+            : value{ stateValue }
+            , hash{ stateHash }
+        {
+        }
+
+        [[nodiscard]] std::size_t getHash() const final
+        {
+            return hash;
+        }
+
+        [[nodiscard]] bool isSameAs(const VisualState& other) const final
+        {
+            const auto* otherState = dynamic_cast<const TestState*>(&other);
+            return otherState != nullptr && otherState->value == value;
+        }
+
+        [[nodiscard]] std::unique_ptr<VisualState> clone() const final
+        {
+            return std::make_unique<TestState>(*this);
+        }
+
+        int value;
+        std::size_t hash;
+    };
+
+    void testCaching()
+    {
+        beginTest("caching");
+
+        jive::RenderCache cache;
+        juce::Image target{ juce::Image::ARGB, 20, 20, true };
+        juce::Graphics g{ target };
+        auto numRenders = 0;
+        const auto render = [&numRenders](juce::Graphics& graphics) {
+            numRenders++;
+            graphics.fillAll(juce::Colours::red);
+        };
+
+        cache.draw(g, TestState{ 123 }, { 10, 10 }, render);
+        expectEquals(numRenders, 1);
+        expectEquals(target.getPixelAt(5, 5), juce::Colours::red);
+        expectEquals(cache.getNumImages(), 1);
+        expectEquals(cache.getSizeInBytes(), std::size_t{ 10 * 10 * 4 });
+
+        cache.draw(g, TestState{ 123 }, { 10, 10, 10, 10 }, render);
+        expectEquals(numRenders, 1);
+        expectEquals(target.getPixelAt(15, 15), juce::Colours::red);
+
+        cache.draw(g, TestState{ 456 }, { 10, 10 }, render);
+        expectEquals(numRenders, 2);
+
+        cache.draw(g, TestState{ 123 }, { 10, 11 }, render);
+        expectEquals(numRenders, 3);
+        expectEquals(cache.getNumImages(), 3);
+    }
+
+    void testHashCollisions()
+    {
+        beginTest("hash collisions");
+
+        jive::RenderCache cache;
+        juce::Image target{ juce::Image::ARGB, 10, 10, true };
+        juce::Graphics g{ target };
+
+        cache.draw(g, TestState{ 1, 0 }, { 10, 10 }, [](juce::Graphics& graphics) {
+            graphics.fillAll(juce::Colours::red);
+        });
+        cache.draw(g, TestState{ 2, 0 }, { 10, 10 }, [](juce::Graphics& graphics) {
+            graphics.fillAll(juce::Colours::blue);
+        });
+        expectEquals(cache.getNumImages(), 2);
+        expectEquals(target.getPixelAt(5, 5), juce::Colours::blue);
+
+        auto numRenders = 0;
+        cache.draw(g, TestState{ 1, 0 }, { 10, 10 }, [&numRenders](juce::Graphics&) {
+            numRenders++;
+        });
+        expectEquals(numRenders, 0);
+        expectEquals(target.getPixelAt(5, 5), juce::Colours::red);
+    }
+
+    void testEviction()
+    {
+        beginTest("eviction");
+
+        jive::RenderCache cache;
+        cache.setMaximumSizeInBytes(2 * 10 * 10 * 4);
+        juce::Image target{ juce::Image::ARGB, 10, 10, true };
+        juce::Graphics g{ target };
+        auto numRenders = 0;
+        const auto render = [&numRenders](juce::Graphics&) {
+            numRenders++;
+        };
+
+        cache.draw(g, TestState{ 1 }, { 10, 10 }, render);
+        cache.draw(g, TestState{ 2 }, { 10, 10 }, render);
+        cache.draw(g, TestState{ 1 }, { 10, 10 }, render);
+        expectEquals(numRenders, 2);
+
+        cache.draw(g, TestState{ 3 }, { 10, 10 }, render);
+        expectEquals(numRenders, 3);
+        expectEquals(cache.getNumImages(), 2);
+        expectEquals(cache.getSizeInBytes(), std::size_t{ 2 * 10 * 10 * 4 });
+
+        cache.draw(g, TestState{ 1 }, { 10, 10 }, render);
+        expectEquals(numRenders, 3);
+
+        cache.draw(g, TestState{ 2 }, { 10, 10 }, render);
+        expectEquals(numRenders, 4);
+
+        cache.clear();
+        expectEquals(cache.getNumImages(), 0);
+        expectEquals(cache.getSizeInBytes(), std::size_t{ 0 });
+    }
+
+    void testDisabling()
+    {
+        beginTest("disabling");
+
+        jive::RenderCache cache;
+        cache.setMaximumSizeInBytes(0);
+        juce::Image target{ juce::Image::ARGB, 10, 10, true };
+        juce::Graphics g{ target };
+        auto numRenders = 0;
+        const auto render = [&numRenders](juce::Graphics& graphics) {
+            numRenders++;
+            graphics.fillAll(juce::Colours::blue);
+        };
+
+        cache.draw(g, TestState{ 1 }, { 10, 10 }, render);
+        cache.draw(g, TestState{ 1 }, { 10, 10 }, render);
+        expectEquals(numRenders, 2);
+        expectEquals(cache.getNumImages(), 0);
+        expectEquals(target.getPixelAt(5, 5), juce::Colours::blue);
+    }
+};
+
+static RenderCacheTest renderCacheTest;
+#endif
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <jive_core/jive_core.h>
+
+#include <list>
+
+namespace jive
+{
+    /** A process-wide, size-capped store of rasterised component output.
+
+        Components describe everything that affects their appearance with a
+        VisualState. As long as that state and the size being painted stay the
+        same, the previously rasterised image is blitted instead of re-running
+        the paint routine. Identical components share their images, and the
+        least recently drawn images are evicted once the total size of the
+        cache exceeds its limit.
+    */
+    class RenderCache : private juce::DeletedAtShutdown
+    {
+    public:
+        /** Everything that affects what a component paints.
+
+            The hash only picks the bucket an image is stored in. Images are
+            matched by comparing the full state, so two states that happen to
+            hash alike never share an image.
+        */
+        class VisualState
+        {
+        public:
+            virtual ~VisualState() = default;
+
+            [[nodiscard]] virtual std::size_t getHash() const = 0;
+            [[nodiscard]] virtual bool isSameAs(const VisualState& other) const = 0;
+
+            /** Returns a copy of this state that the cache can keep. */
+            [[nodiscard]] virtual std::unique_ptr<VisualState> clone() const = 0;
+        };
+
+        RenderCache() = default;
+        ~RenderCache() override;
+
+        /** Draws the image cached for the given visual state into the given
+            bounds, calling the render function to rasterise it first if there
+            isn't one.
+
+            If a single image would exceed the cache's maximum size, the render
+            function is called on the given graphics context directly.
+        */
+        void draw(juce::Graphics& g,
+                  const VisualState& visualState,
+                  juce::Rectangle<int> bounds,
+                  const std::function<void(juce::Graphics&)>& render);
+
+        [[nodiscard]] std::size_t getMaximumSizeInBytes() const;
+        void setMaximumSizeInBytes(std::size_t newMaximumSize);
+
+        [[nodiscard]] std::size_t getSizeInBytes() const;
+        [[nodiscard]] int getNumImages() const;
+
+        void clear();
+
+        static constexpr std::size_t defaultMaximumSizeInBytes = 32 * 1024 * 1024;
+
+        JUCE_DECLARE_SINGLETON(RenderCache, false)
+
+    private:
+        struct Key
+        {
+            [[nodiscard]] bool operator==(const Key& other) const;
+
+            const VisualState* visualState{ nullptr };
+            int width{ 0 };
+            int height{ 0 };
+            float scale{ 1.0f };
+        };
+
+        struct KeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const Key& key) const noexcept;
+        };
+
+        struct Entry
+        {
+            std::unique_ptr<VisualState> visualState;
+            Key key;
+            juce::Image image;
+            std::size_t sizeInBytes{ 0 };
+        };
+
+        [[nodiscard]] const juce::Image& getImage(const Key& key,
+                                                  juce::Rectangle<int> bounds,
+                                                  const std::function<void(juce::Graphics&)>& render);
+        void evictUntilWithin(std::size_t maximumSize);
+
+        std::list<Entry> entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+        std::size_t sizeInBytes{ 0 };
+        std::size_t maximumSizeInBytes{ defaultMaximumSizeInBytes };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderCache)
+    };
+} // namespace jive
@@ -3,7 +3,9 @@
 #include "accessibility/jive_IgnoredComponent.cpp"
 
 #include "canvases/jive_BackgroundCanvas.cpp"
+#include "canvases/jive_BackgroundShapeCache.cpp"
 #include "canvases/jive_Canvas.cpp"
+#include "canvases/jive_RenderCache.cpp"
 
 #include "containers/jive_DocumentWindow.cpp"
 
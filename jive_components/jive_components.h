@@ -15,7 +15,9 @@ END_JUCE_MODULE_DECLARATION */
 #include "accessibility/jive_IgnoredComponent.h"
 
 #include "canvases/jive_BackgroundCanvas.h"
+#include "canvases/jive_BackgroundShapeCache.h"
 #include "canvases/jive_Canvas.h"
+#include "canvases/jive_RenderCache.h"
 
 #include "containers/jive_DocumentWindow.h"
 
@@ -2,17 +2,66 @@
 
 namespace jive
 {
+    class TextComponent::VisualState final : public RenderCache::VisualState
+    {
+    public:
+        VisualState(const juce::AttributedString& text, std::size_t textHash)
+            : attributedString{ &text }
+            , hash{ textHash }
+        {
+        }
+
+        [[nodiscard]] std::size_t getHash() const final
+        {
+            return hash;
+        }
+
+        [[nodiscard]] bool isSameAs(const RenderCache::VisualState& other) const final
+        {
+            const auto* otherState = dynamic_cast<const VisualState*>(&other);
+
+            return otherState != nullptr
+                && otherState->hash == hash
+                && areEqual(*otherState->attributedString, *attributedString);
+        }
+
+        [[nodiscard]] std::unique_ptr<RenderCache::VisualState> clone() const final
+        {
+            auto ownedString = std::make_shared<const juce::AttributedString>(*attributedString);
+            auto copy = std::make_unique<VisualState>(*ownedString, hash);
+            copy->ownedString = std::move(ownedString);
+
+            return copy;
+        }
+
+    private:
+        // Only set for copies kept by the cache. The state drawn with refers
+        // to the component's own attributed string.
+        std::shared_ptr<const juce::AttributedString> ownedString;
+        const juce::AttributedString* attributedString;
+        std::size_t hash;
+    };
+
     TextComponent::TextComponent()
     {
         canvas.onPaint = [this](juce::Graphics& g) {
+            JIVE_PROFILE_SCOPE("TextComponent::paint");
+
             if (dynamic_cast<TextComponent*>(getParentComponent()) != nullptr)
                 return;
 
-            getAttributedString()
-                .draw(g, getLocalBounds().toFloat());
+            if (getAttributedString().getText().isEmpty())
+                return;
+
+            RenderCache::getInstance()->draw(g,
+                                             VisualState{ getAttributedString(), getAttributedStringHash() },
+                                             getLocalBounds(),
+                                             [this](juce::Graphics& imageGraphics) {
+                                                 const auto bounds = getLocalBounds().toFloat();
+                                                 getTextLayout(bounds.getWidth()).draw(imageGraphics, bounds);
+                                             });
         };
         canvas.setAlwaysOnTop(true);
-        canvas.setBufferedToImage(true);
         addAndMakeVisible(canvas);
 
         setInterceptsMouseClicks(false, false);
@@ -33,7 +82,7 @@ namespace jive
         if (newText != text)
         {
             text = newText;
-            canvas.repaint();
+            attributesChanged();
         }
     }
 
@@ -47,8 +96,8 @@ namespace jive
         if (newFont != font)
         {
             font = newFont;
+            attributesChanged();
             listeners.call(&Listener::textFontChanged, *this);
-            canvas.repaint();
         }
     }
 
@@ -57,7 +106,7 @@ namespace jive
         if (newJustification != justification)
         {
             justification = newJustification;
-            canvas.repaint();
+            attributesChanged();
         }
     }
 
@@ -66,7 +115,7 @@ namespace jive
         if (newWordWrap != wordWrap)
         {
             wordWrap = newWordWrap;
-            canvas.repaint();
+            attributesChanged();
         }
     }
 
@@ -75,7 +124,7 @@ namespace jive
         if (newDirection != direction)
         {
             direction = newDirection;
-            canvas.repaint();
+            attributesChanged();
         }
     }
 
@@ -84,7 +133,7 @@ namespace jive
         if (!juce::approximatelyEqual(newLineSpacing, lineSpacing))
         {
             lineSpacing = newLineSpacing;
-            canvas.repaint();
+            attributesChanged();
         }
     }
 
@@ -98,43 +147,159 @@ namespace jive
         if (newColour != textColour)
         {
             textColour = newColour;
-            canvas.repaint();
+            coloursChanged();
         }
     }
 
     void TextComponent::clearAttributes()
     {
+        if (appendices.isEmpty())
+            return;
+
         appendices.clear();
-        canvas.repaint();
+        attributesChanged();
     }
 
     void TextComponent::append(const juce::AttributedString& attributedStringToAppend)
     {
         appendices.add(attributedStringToAppend);
-        canvas.repaint();
+        attributesChanged();
+    }
+
+    int TextComponent::getNumAppendices() const
+    {
+        return appendices.size();
+    }
+
+    void TextComponent::setAppendix(int index, const juce::AttributedString& newAppendix)
+    {
+        jassert(juce::isPositiveAndBelow(index, appendices.size()));
+
+        auto& appendix = appendices.getReference(index);
+
+        if (areEqual(newAppendix, appendix))
+            return;
+
+        const auto onlyColoursChanged = haveSameLayout(newAppendix, appendix);
+        appendix = newAppendix;
+
+        if (onlyColoursChanged)
+            coloursChanged();
+        else
+            attributesChanged();
     }
 
-    juce::AttributedString TextComponent::getAttributedString() const
+    juce::Range<int> TextComponent::getAppendixRange(int index) const
     {
-        juce::AttributedString attributedString;
+        jassert(juce::isPositiveAndBelow(index, appendices.size()));
 
-        attributedString.setText(text);
+        auto start = text.length();
 
-        attributedString.setFont(font);
-        attributedString.setJustification(justification);
-        attributedString.setLineSpacing(lineSpacing);
-        attributedString.setReadingDirection(direction);
-        attributedString.setWordWrap(wordWrap);
+        for (auto i = 0; i < index; i++)
+            start += appendices.getReference(i).getText().length();
+
+        return juce::Range<int>::withStartAndLength(start,
+                                                    appendices.getReference(index).getText().length());
+    }
+
+    const juce::AttributedString& TextComponent::getAttributedString() const
+    {
+        if (attributedString.has_value())
+            return *attributedString;
+
+        auto& newString = attributedString.emplace();
+
+        newString.setText(text);
+
+        newString.setFont(font);
+        newString.setJustification(justification);
+        newString.setLineSpacing(lineSpacing);
+        newString.setReadingDirection(direction);
+        newString.setWordWrap(wordWrap);
 
         for (const auto& appendix : appendices)
-            attributedString.append(appendix);
+            newString.append(appendix);
 
         if (textColour.has_value())
-            attributedString.setColour(*textColour);
+            newString.setColour(*textColour);
         else if (appendices.size() == 0)
-            attributedString.setColour(juce::Colours::black);
+            newString.setColour(juce::Colours::black);
+
+        return newString;
+    }
+
+    std::size_t TextComponent::getAttributedStringHash() const
+    {
+        if (!attributedStringHash.has_value())
+            attributedStringHash = std::hash<juce::AttributedString>{}(getAttributedString());
 
-        return attributedString;
+        return *attributedStringHash;
+    }
+
+    std::size_t TextComponent::getLayoutHash() const
+    {
+        if (!layoutHash.has_value())
+            layoutHash = hashLayout(getAttributedString());
+
+        return *layoutHash;
+    }
+
+    const juce::TextLayout& TextComponent::getTextLayout(float maxWidth) const
+    {
+        if (textLayout == nullptr || !juce::exactlyEqual(maxWidth, textLayoutWidth))
+        {
+            textLayout = TextLayoutCache::getInstance()->getLayout(getAttributedString(),
+                                                                  getLayoutHash(),
+                                                                  maxWidth);
+            textLayoutWidth = maxWidth;
+            ownsTextLayout = false;
+        }
+
+        return *textLayout;
+    }
+
+    juce::uint32 TextComponent::getVersion() const
+    {
+        return version;
+    }
+
+    void TextComponent::attributesChanged()
+    {
+        version++;
+        attributedString.reset();
+        attributedStringHash.reset();
+        layoutHash.reset();
+        textLayout = nullptr;
+
+        canvas.repaint();
+        listeners.call(&Listener::attributedStringChanged, *this);
+    }
+
+    void TextComponent::coloursChanged()
+    {
+        // The layout hash and the metrics that depend on it stay valid
+        attributedString.reset();
+        attributedStringHash.reset();
+
+        if (textLayout != nullptr)
+            recolourTextLayout();
+
+        canvas.repaint();
+        listeners.call(&Listener::attributedStringRecoloured, *this);
+    }
+
+    void TextComponent::recolourTextLayout()
+    {
+        // Colours don't affect the layout, so the shaped glyphs can be kept
+        // and only their runs recoloured
+        auto layout = ownsTextLayout && textLayout.use_count() == 1
+                        ? std::const_pointer_cast<juce::TextLayout>(std::move(textLayout))
+                        : std::make_shared<juce::TextLayout>(*textLayout);
+
+        recolour(*layout, getAttributedString());
+
+        textLayout = std::move(layout);
+        ownsTextLayout = true;
     }
 
     void TextComponent::addListener(Listener& listener) const
@@ -219,3 +384,72 @@ namespace jive
         return std::make_unique<AccessibilityHandler>(*this);
     }
 } // namespace jive
+
+#if JIVE_UNIT_TESTS
+class TextComponentTest : public juce::UnitTest
+{
+public:
+    TextComponentTest()
+        : juce::UnitTest{ "jive::TextComponent", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testAttributedStringCaching();
+        testRecolouring();
+    }
+
+private:
+    void testAttributedStringCaching()
+    {
+        beginTest("attributed string caching");
+
+        jive::TextComponent text;
+        text.setText("Some text");
+        const auto version = text.getVersion();
+        const auto* attributedString = &text.getAttributedString();
+        const auto hash = text.getAttributedStringHash();
+        expect(&text.getAttributedString() == attributedString);
+        expectEquals(text.getVersion(), version);
+
+        text.setText("Some text");
+        expectEquals(text.getVersion(), version);
+
+        text.setJustification(juce::Justification::centred);
+        expectGreaterThan(text.getVersion(), version);
+        expect(text.getAttributedString().getJustification() == juce::Justification::centred);
+        expect(text.getAttributedStringHash() != hash);
+    }
+
+    void testRecolouring()
+    {
+        beginTest("recolouring");
+
+        jive::TextComponent text;
+        text.setText("Lorem ipsum dolor sit amet");
+        const auto numLines = text.getTextLayout(50.0f).getNumLines();
+        expectGreaterThan(numLines, 1);
+        const auto version = text.getVersion();
+        const auto layoutHash = text.getLayoutHash();
+
+        text.setTextColour(juce::Colours::red);
+        const auto& layout = text.getTextLayout(50.0f);
+        expectEquals(layout.getNumLines(), numLines);
+        expectEquals(text.getVersion(), version);
+        expect(text.getLayoutHash() == layoutHash);
+
+        for (auto i = 0; i < layout.getNumLines(); i++)
+        {
+            for (const auto* run : layout.getLine(i).runs)
+                expect(run->colour == juce::Colours::red);
+        }
+
+        text.setTextColour(juce::Colours::blue);
+        expect(&text.getTextLayout(50.0f) == &layout);
+        expect(layout.getLine(0).runs.getFirst()->colour == juce::Colours::blue);
+    }
+};
+
+static TextComponentTest textComponentTest;
+#endif
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <jive_components/canvases/jive_Canvas.h>
+#include <jive_components/canvases/jive_RenderCache.h>
+
+#include <jive_core/jive_core.h>
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
@@ -17,6 +20,16 @@ namespace jive
             virtual ~Listener() = default;
 
             virtual void textFontChanged(TextComponent& text) = 0;
+
+            /** Called when anything that affects how the attributed string is
+                laid out changes.
+            */
+            virtual void attributedStringChanged(TextComponent&) {}
+
+            /** Called when only the colours of the attributed string change,
+                which never affects its layout.
+            */
+            virtual void attributedStringRecoloured(TextComponent&) {}
         };
 
         TextComponent();
@@ -43,14 +56,41 @@ namespace jive
         void clearAttributes();
         void append(const juce::AttributedString& attributedStringToAppend);
 
-        [[nodiscard]] juce::AttributedString getAttributedString() const;
+        [[nodiscard]] int getNumAppendices() const;
+        void setAppendix(int index, const juce::AttributedString& newAppendix);
+
+        /** Returns the range of characters in the attributed string that are
+            taken up by the appendix at the given index.
+        */
+        [[nodiscard]] juce::Range<int> getAppendixRange(int index) const;
+
+        [[nodiscard]] const juce::AttributedString& getAttributedString() const;
+        [[nodiscard]] std::size_t getAttributedStringHash() const;
+
+        /** Returns a hash of everything that affects how the attributed
+            string is laid out, i.e. everything except its colours.
+        */
+        [[nodiscard]] std::size_t getLayoutHash() const;
+        [[nodiscard]] const juce::TextLayout& getTextLayout(float maxWidth) const;
+
+        /** Returns a number that changes whenever anything affecting how
+            the attributed string is laid out changes. Changing only its
+            colours leaves the version as it is.
+        */
+        [[nodiscard]] juce::uint32 getVersion() const;
 
         void addListener(Listener&) const;
         void removeListener(Listener&) const;
 
     private:
+        class VisualState;
+
         std::unique_ptr<juce::AccessibilityHandler> createAccessibilityHandler() override;
 
+        void attributesChanged();
+        void coloursChanged();
+        void recolourTextLayout();
+
         juce::AttributedString::ReadingDirection direction{ juce::AttributedString::ReadingDirection::natural };
         juce::Font font{
 #if JUCE_MAJOR_VERSION >= 8
@@ -64,6 +104,14 @@ namespace jive
         juce::AttributedString::WordWrap wordWrap{ juce::AttributedString::WordWrap::byWord };
         juce::Array<juce::AttributedString> appendices;
 
+        juce::uint32 version{ 0 };
+        mutable std::optional<juce::AttributedString> attributedString;
+        mutable std::optional<std::size_t> attributedStringHash;
+        mutable std::optional<std::size_t> layoutHash;
+        mutable std::shared_ptr<const juce::TextLayout> textLayout;
+        mutable float textLayoutWidth{ 0.0f };
+        mutable bool ownsTextLayout{ false };
+
         Canvas canvas;
 
         mutable juce::ListenerList<Listener> listeners;
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace jive
+{
+    template <typename Value>
+    void combineHash(std::size_t& seed, const Value& value)
+    {
+        seed ^= std::hash<Value>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+
+    template <typename... Values>
+    [[nodiscard]] std::size_t hashAll(const Values&... values)
+    {
+        std::size_t seed = 0;
+        (combineHash(seed, values), ...);
+        return seed;
+    }
+} // namespace jive
+
+namespace std
+{
+    template <>
+    struct hash<juce::Identifier>
+    {
+        [[nodiscard]] std::size_t operator()(const juce::Identifier& id) const noexcept
+        {
+            // Identifiers are interned in a global pool, so the address of
+            // the name identifies it without hashing the string
+            return std::hash<const void*>{}(id.getCharPointer().getAddress());
+        }
+    };
+} // namespace std
@@ -111,6 +111,25 @@ private:
                                        jive::Fill{ juce::Colours::aliceblue },
                                        0.7),
                      jive::Fill{ juce::Colours::aliceblue });
+
+        beginTest("gradient");
+        jive::Gradient start;
+        start.stops.add({ 0.0, juce::Colours::red });
+        start.stops.add({ 1.0, juce::Colours::blue });
+        start.orientation = jive::Orientation::vertical;
+
+        auto end = start;
+        end.stops.getReference(0).colour = juce::Colours::green;
+        end.stops.getReference(1).proportion = 0.5;
+
+        auto expected = end;
+        expected.stops.getReference(0).colour = juce::Colours::red.interpolatedWith(juce::Colours::green, 0.25f);
+        expected.stops.getReference(1).proportion = 0.875;
+        expectEquals(jive::interpolate(jive::Fill{ start }, jive::Fill{ end }, 0.25),
+                     jive::Fill{ expected });
+
+        end.stops.add({ 1.0, juce::Colours::white });
+        expectEquals(jive::interpolate(start, end, 0.25), end);
     }
 };
 
@@ -135,6 +135,54 @@ namespace jive
         }
     };
 
+    template <>
+    struct Interpolate<Gradient::ColourStop>
+    {
+        [[nodiscard]] Gradient::ColourStop operator()(const Gradient::ColourStop& start,
+                                                      const Gradient::ColourStop& end,
+                                                      double proportion) const
+        {
+            return Gradient::ColourStop{
+                interpolate(start.proportion, end.proportion, proportion),
+                interpolate(start.colour, end.colour, proportion),
+            };
+        }
+    };
+
+    template <>
+    struct Interpolate<Gradient>
+    {
+        [[nodiscard]] Gradient operator()(const Gradient& start, const Gradient& end, double proportion) const
+        {
+            if (start.variant != end.variant
+                || start.orientation != end.orientation
+                || start.stops.size() != end.stops.size())
+            {
+                return end;
+            }
+
+            auto result = end;
+
+            for (auto i = 0; i < result.stops.size(); i++)
+            {
+                auto& stop = result.stops.getReference(i);
+                stop = interpolate(start.stops.getReference(i), stop, proportion);
+            }
+
+            if (start.startEndPoints.hasValue() && end.startEndPoints.hasValue())
+            {
+                result.startEndPoints = juce::Line<float>{
+                    interpolate(start.startEndPoints->getStartX(), end.startEndPoints->getStartX(), proportion),
+                    interpolate(start.startEndPoints->getStartY(), end.startEndPoints->getStartY(), proportion),
+                    interpolate(start.startEndPoints->getEndX(), end.startEndPoints->getEndX(), proportion),
+                    interpolate(start.startEndPoints->getEndY(), end.startEndPoints->getEndY(), proportion),
+                };
+            }
+
+            return result;
+        }
+    };
+
     template <>
     struct Interpolate<Fill>
     {
@@ -147,6 +195,13 @@ namespace jive
                 };
             }
 
+            if (start.getGradient().has_value() && end.getGradient().has_value())
+            {
+                return Fill{
+                    interpolate(*start.getGradient(), *end.getGradient(), proportion),
+                };
+            }
+
             return end;
         }
     };
@@ -35,7 +35,7 @@ namespace jive
             componentHeight = height.toPixels(getParentBounds());
 
         const auto informBoxModelChanged = [this]() {
-            listeners.call(&Listener::boxModelChanged, *this);
+            informListeners();
         };
         const auto onBoxModelChanged = [this, informBoxModelChanged]() {
             if (callbackLock.get())
@@ -96,6 +96,11 @@ namespace jive
         margin.onTransitionProgressed = informBoxModelChanged;
     }
 
+    BoxModel::~BoxModel()
+    {
+        PropertyTransaction::cancel(this);
+    }
+
     float BoxModel::getWidth() const
     {
         if (auto* transition = componentWidth.getTransition())
@@ -250,8 +255,21 @@ namespace jive
 
     void BoxModel::unlock()
     {
+        // Changes deferred by a transaction would otherwise be delivered after
+        // the lock is released
+        PropertyTransaction::flush(state);
         callbackLock.clear();
     }
+
+    void BoxModel::informListeners()
+    {
+        const auto deferred = PropertyTransaction::deferUntilComplete(state, this, [this] {
+            listeners.call(&Listener::boxModelChanged, *this);
+        });
+
+        if (!deferred)
+            listeners.call(&Listener::boxModelChanged, *this);
+    }
 } // namespace jive
 
 #if JIVE_UNIT_TESTS
@@ -274,6 +292,7 @@ public:
         testMargin();
         testContentBounds();
         testTransitions();
+        testTransactions();
     }
 
 private:
@@ -563,6 +582,40 @@ private:
             expectWithinAbsoluteError(listener.callbackCount, 60, 1);
         }
     }
+
+    void testTransactions()
+    {
+        beginTest("transactions");
+
+        juce::ValueTree state{ "Component" };
+        jive::BoxModel boxModel{ state };
+        Listener listener;
+        boxModel.addListener(listener);
+
+        {
+            const jive::PropertyTransaction transaction{ state };
+            state.setProperty("padding", "5", nullptr);
+            state.setProperty("border-width", "6", nullptr);
+            state.setProperty("width", 123, nullptr);
+            state.setProperty("height", 987, nullptr);
+            expectEquals(listener.callbackCount, 0);
+        }
+
+        expectEquals(listener.callbackCount, 1);
+        expectEquals(boxModel.getWidth(), 123.0f);
+        expectEquals(boxModel.getHeight(), 987.0f);
+
+        {
+            const jive::PropertyTransaction transaction{ state };
+
+            {
+                const jive::BoxModel::ScopedCallbackLock lock{ boxModel };
+                state.setProperty("padding", "10", nullptr);
+            }
+        }
+
+        expectEquals(listener.callbackCount, 1);
+    }
 };
 
 static BoxModelUnitTest boxModelUnitTest;
@@ -24,6 +24,10 @@ namespace jive
             ValueTree. However, so long as you're sure you know what you're
             doing, this can be very useful when setting several properties at
             once and you don't want callbacks firing for each one.
+
+            Changes made while the lock is held are dropped rather than
+            deferred - use a PropertyTransaction to have them delivered once
+            the properties have all been set.
         */
         class ScopedCallbackLock
         {
@@ -36,6 +40,7 @@ namespace jive
         };
 
         explicit BoxModel(juce::ValueTree sourceState);
+        ~BoxModel();
 
         [[nodiscard]] float getWidth() const;
         void setWidth(float newWidth);
@@ -73,6 +78,7 @@ namespace jive
     private:
         void lock();
         void unlock();
+        void informListeners();
 
         juce::Rectangle<float> getParentBounds() const;
 
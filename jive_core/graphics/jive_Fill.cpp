@@ -1,5 +1,6 @@
 #include "jive_Fill.h"
 
+#include <jive_core/algorithms/jive_Hash.h>
 #include <jive_core/logging/jive_StringStreams.h>
 #include <jive_core/values/variant-converters/jive_MiscVariantConverters.h>
 
@@ -31,7 +32,7 @@ namespace jive
         gradient.reset();
     }
 
-    std::optional<Gradient> Fill::getGradient() const
+    const std::optional<Gradient>& Fill::getGradient() const
     {
         return gradient;
     }
@@ -92,3 +93,17 @@ namespace juce
         return str;
     }
 } // namespace juce
+
+namespace std
+{
+    std::size_t hash<jive::Fill>::operator()(const jive::Fill& fill) const noexcept
+    {
+        if (fill.getColour().has_value())
+            return jive::hashAll(fill.getColour()->getARGB());
+
+        if (fill.getGradient().has_value())
+            return jive::hashAll(*fill.getGradient());
+
+        return 0;
+    }
+} // namespace std
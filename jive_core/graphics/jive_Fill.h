@@ -16,7 +16,7 @@ namespace jive
         std::optional<juce::Colour> getColour() const;
         void setColour(juce::Colour newColour);
 
-        std::optional<Gradient> getGradient() const;
+        const std::optional<Gradient>& getGradient() const;
         void setGradient(Gradient newGradient);
 
         bool operator==(const Fill& other) const;
@@ -40,3 +40,12 @@ namespace juce
 
     String& operator<<(String& str, const jive::Fill& fill);
 } // namespace juce
+
+namespace std
+{
+    template <>
+    struct hash<jive::Fill>
+    {
+        [[nodiscard]] std::size_t operator()(const jive::Fill& fill) const noexcept;
+    };
+} // namespace std
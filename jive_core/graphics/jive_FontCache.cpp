@@ -0,0 +1,163 @@
+#include "jive_FontCache.h"
+
+#include <jive_core/algorithms/jive_Hash.h>
+
+namespace jive
+{
+    bool FontCache::Descriptor::operator==(const Descriptor& other) const
+    {
+        return family == other.family
+            && juce::exactlyEqual(pointHeight, other.pointHeight)
+            && juce::exactlyEqual(letterSpacing, other.letterSpacing)
+            && juce::exactlyEqual(stretch, other.stretch)
+            && italic == other.italic
+            && bold == other.bold
+            && underlined == other.underlined;
+    }
+
+    bool FontCache::Descriptor::operator!=(const Descriptor& other) const
+    {
+        return !(*this == other);
+    }
+
+    std::size_t FontCache::DescriptorHash::operator()(const Descriptor& descriptor) const noexcept
+    {
+        return hashAll(descriptor.family.hash(),
+                       descriptor.pointHeight,
+                       descriptor.letterSpacing,
+                       descriptor.stretch,
+                       descriptor.italic,
+                       descriptor.bold,
+                       descriptor.underlined);
+    }
+
+    FontCache::~FontCache()
+    {
+        clearSingletonInstance();
+    }
+
+    [[nodiscard]] static juce::Font resolveFont(const FontCache::Descriptor& descriptor)
+    {
+        juce::Font font{
+#if JUCE_MAJOR_VERSION >= 8
+            juce::FontOptions{},
+#endif
+        };
+
+        font.setTypefaceName(descriptor.family);
+
+        if (juce::Font::getDefaultTypefaceForFont(font) == nullptr)
+            return font;
+
+        font.setItalic(descriptor.italic);
+        font.setBold(descriptor.bold);
+        font = font.withPointHeight(descriptor.pointHeight);
+        font.setExtraKerningFactor(descriptor.letterSpacing / font.getHeight());
+        font.setUnderline(descriptor.underlined);
+        font.setHorizontalScale(descriptor.stretch);
+
+        return font;
+    }
+
+    juce::Font FontCache::getFont(const Descriptor& descriptor)
+    {
+        if (const auto existing = index.find(descriptor);
+            existing != std::end(index))
+        {
+            entries.splice(std::begin(entries), entries, existing->second);
+            return entries.front().font;
+        }
+
+        if (getNumFonts() >= maximumNumFonts)
+        {
+            index.erase(entries.back().descriptor);
+            entries.pop_back();
+        }
+
+        entries.push_front(Entry{ descriptor, resolveFont(descriptor) });
+        index[descriptor] = std::begin(entries);
+
+        return entries.front().font;
+    }
+
+    int FontCache::getNumFonts() const
+    {
+        return static_cast<int>(std::size(entries));
+    }
+
+    void FontCache::clear()
+    {
+        index.clear();
+        entries.clear();
+    }
+
+    JUCE_IMPLEMENT_SINGLETON(FontCache)
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class FontCacheTest : public juce::UnitTest
+{
+public:
+    FontCacheTest()
+        : juce::UnitTest{ "jive::FontCache", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCaching();
+        testEviction();
+    }
+
+private:
+    void testCaching()
+    {
+        beginTest("caching");
+
+        jive::FontCache cache;
+        jive::FontCache::Descriptor descriptor;
+        descriptor.family = juce::Font::getDefaultSansSerifFontName();
+        descriptor.pointHeight = 20.0f;
+        descriptor.bold = true;
+
+        const auto font = cache.getFont(descriptor);
+        expect(font == cache.getFont(descriptor));
+        expectEquals(cache.getNumFonts(), 1);
+
+        descriptor.italic = true;
+        const auto italicFont = cache.getFont(descriptor);
+        expect(italicFont != font);
+        expect(italicFont.isItalic());
+        expectEquals(cache.getNumFonts(), 2);
+
+        cache.clear();
+        expectEquals(cache.getNumFonts(), 0);
+    }
+
+    void testEviction()
+    {
+        beginTest("eviction");
+
+        jive::FontCache cache;
+        jive::FontCache::Descriptor descriptor;
+        descriptor.family = juce::Font::getDefaultSansSerifFontName();
+
+        const auto getFont = [&cache, &descriptor](int index) {
+            descriptor.pointHeight = static_cast<float>(index + 1);
+            return cache.getFont(descriptor);
+        };
+
+        for (auto i = 0; i < jive::FontCache::maximumNumFonts; i++)
+            juce::ignoreUnused(getFont(i));
+
+        expectEquals(cache.getNumFonts(), jive::FontCache::maximumNumFonts);
+
+        // Making room for a new font only evicts the least recently used
+        // one, rather than the whole cache
+        juce::ignoreUnused(getFont(jive::FontCache::maximumNumFonts));
+        expectEquals(cache.getNumFonts(), jive::FontCache::maximumNumFonts);
+    }
+};
+
+static FontCacheTest fontCacheTest;
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+
+#include <list>
+
+namespace jive
+{
+    /** A process-wide cache of fonts resolved from style descriptors.
+
+        Resolving a font means probing the typeface for its family and then
+        applying the style, weight, size, spacing, decoration and stretch.
+        Every descriptor is only resolved once, and all requests for it share
+        the same juce::Font, which also makes comparing those fonts cheap.
+
+        Once the cache holds maximumNumFonts fonts, the least recently used
+        one is evicted to make room for each new one.
+    */
+    class FontCache : private juce::DeletedAtShutdown
+    {
+    public:
+        struct Descriptor
+        {
+            [[nodiscard]] bool operator==(const Descriptor& other) const;
+            [[nodiscard]] bool operator!=(const Descriptor& other) const;
+
+            juce::String family;
+            float pointHeight{ 14.0f };
+            float letterSpacing{ 0.0f };
+            float stretch{ 1.0f };
+            bool italic{ false };
+            bool bold{ false };
+            bool underlined{ false };
+        };
+
+        FontCache() = default;
+        ~FontCache() override;
+
+        [[nodiscard]] juce::Font getFont(const Descriptor& descriptor);
+
+        [[nodiscard]] int getNumFonts() const;
+        void clear();
+
+        static constexpr int maximumNumFonts = 256;
+
+        JUCE_DECLARE_SINGLETON(FontCache, false)
+
+    private:
+        struct DescriptorHash
+        {
+            [[nodiscard]] std::size_t operator()(const Descriptor& descriptor) const noexcept;
+        };
+
+        struct Entry
+        {
+            Descriptor descriptor;
+            juce::Font font;
+        };
+
+        std::list<Entry> entries;
+        std::unordered_map<Descriptor, std::list<Entry>::iterator, DescriptorHash> index;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FontCache)
+    };
+} // namespace jive
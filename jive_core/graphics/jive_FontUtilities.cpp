@@ -1,6 +1,6 @@
 #include "jive_FontUtilities.h"
 
-#include <juce_graphics/juce_graphics.h>
+#include <jive_core/algorithms/jive_Hash.h>
 
 namespace jive
 {
@@ -18,4 +18,160 @@ namespace jive
 
         return flags;
     }
+
+    // Attributes that only differ in their colour are laid out as one run,
+    // so a change in colour that splits or merges attributes doesn't change
+    // the layout
+    struct FontRun
+    {
+        juce::Range<int> range;
+        const juce::Font* font{ nullptr };
+    };
+
+    [[nodiscard]] static bool nextFontRun(const juce::AttributedString& attributedString,
+                                          int& attributeIndex,
+                                          FontRun& run)
+    {
+        if (attributeIndex >= attributedString.getNumAttributes())
+            return false;
+
+        const auto& first = attributedString.getAttribute(attributeIndex++);
+        run = FontRun{ first.range, &first.font };
+
+        while (attributeIndex < attributedString.getNumAttributes())
+        {
+            const auto& next = attributedString.getAttribute(attributeIndex);
+
+            if (next.font != *run.font || next.range.getStart() != run.range.getEnd())
+                break;
+
+            run.range = run.range.withEnd(next.range.getEnd());
+            attributeIndex++;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] static bool haveSameParagraphs(const juce::AttributedString& first,
+                                                 const juce::AttributedString& second)
+    {
+        return first.getText() == second.getText()
+            && first.getJustification() == second.getJustification()
+            && first.getWordWrap() == second.getWordWrap()
+            && first.getReadingDirection() == second.getReadingDirection()
+            && juce::exactlyEqual(first.getLineSpacing(), second.getLineSpacing());
+    }
+
+    std::size_t hashLayout(const juce::AttributedString& attributedString)
+    {
+        auto seed = hashAll(attributedString.getText().hash(),
+                            attributedString.getJustification().getFlags(),
+                            attributedString.getWordWrap(),
+                            attributedString.getReadingDirection(),
+                            attributedString.getLineSpacing());
+
+        auto attributeIndex = 0;
+        FontRun run;
+
+        while (nextFontRun(attributedString, attributeIndex, run))
+        {
+            combineHash(seed, run.range.getStart());
+            combineHash(seed, run.range.getEnd());
+            combineHash(seed, *run.font);
+        }
+
+        return seed;
+    }
+
+    bool haveSameLayout(const juce::AttributedString& first,
+                        const juce::AttributedString& second)
+    {
+        if (!haveSameParagraphs(first, second))
+            return false;
+
+        auto firstIndex = 0;
+        auto secondIndex = 0;
+        FontRun firstRun;
+        FontRun secondRun;
+
+        while (true)
+        {
+            const auto hasFirstRun = nextFontRun(first, firstIndex, firstRun);
+            const auto hasSecondRun = nextFontRun(second, secondIndex, secondRun);
+
+            if (hasFirstRun != hasSecondRun)
+                return false;
+            if (!hasFirstRun)
+                return true;
+            if (firstRun.range != secondRun.range || *firstRun.font != *secondRun.font)
+                return false;
+        }
+    }
+
+    bool areEqual(const juce::AttributedString& first,
+                  const juce::AttributedString& second)
+    {
+        if (!haveSameParagraphs(first, second)
+            || first.getNumAttributes() != second.getNumAttributes())
+        {
+            return false;
+        }
+
+        for (auto i = 0; i < first.getNumAttributes(); i++)
+        {
+            const auto& firstAttribute = first.getAttribute(i);
+            const auto& secondAttribute = second.getAttribute(i);
+
+            if (firstAttribute.range != secondAttribute.range
+                || firstAttribute.font != secondAttribute.font
+                || firstAttribute.colour != secondAttribute.colour)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void recolour(juce::TextLayout& layout, const juce::AttributedString& attributedString)
+    {
+        for (auto i = 0; i < layout.getNumLines(); i++)
+        {
+            for (auto* run : layout.getLine(i).runs)
+            {
+                for (auto j = 0; j < attributedString.getNumAttributes(); j++)
+                {
+                    if (const auto& attribute = attributedString.getAttribute(j);
+                        attribute.range.contains(run->stringRange.getStart()))
+                    {
+                        run->colour = attribute.colour;
+                        break;
+                    }
+                }
+            }
+        }
+    }
 } // namespace jive
+
+namespace std
+{
+    std::size_t hash<juce::Font>::operator()(const juce::Font& font) const noexcept
+    {
+        return jive::hashAll(font.getTypefaceName().hash(),
+                             font.getTypefaceStyle().hash(),
+                             font.getHeight(),
+                             font.getHorizontalScale(),
+                             font.getExtraKerningFactor(),
+                             font.isUnderlined());
+    }
+
+    std::size_t hash<juce::AttributedString>::operator()(const juce::AttributedString& attributedString) const noexcept
+    {
+        auto seed = jive::hashLayout(attributedString);
+
+        for (auto i = 0; i < attributedString.getNumAttributes(); i++)
+            jive::combineHash(seed, attributedString.getAttribute(i).colour.getARGB());
+
+        return seed;
+    }
+} // namespace std
@@ -1,8 +1,46 @@
 #pragma once
 
-#include <juce_core/juce_core.h>
+#include <juce_graphics/juce_graphics.h>
 
 namespace jive
 {
     int parseFontStyleFlags(const juce::String& styleString);
+
+    /** Returns a hash of everything that affects how the string is laid out:
+        its text, paragraph settings and which ranges use which fonts, but not
+        its colours.
+    */
+    [[nodiscard]] std::size_t hashLayout(const juce::AttributedString& attributedString);
+
+    /** Returns true if the two strings would be laid out identically, i.e.
+        if they only differ in their colours.
+    */
+    [[nodiscard]] bool haveSameLayout(const juce::AttributedString& first,
+                                      const juce::AttributedString& second);
+
+    /** Returns true if the two strings have the same text, paragraph settings
+        and attributes, including their colours.
+    */
+    [[nodiscard]] bool areEqual(const juce::AttributedString& first,
+                                const juce::AttributedString& second);
+
+    /** Applies the colours of the given string to the runs of a layout that
+        was created from a string with the same layout.
+    */
+    void recolour(juce::TextLayout& layout, const juce::AttributedString& attributedString);
 } // namespace jive
+
+namespace std
+{
+    template <>
+    struct hash<juce::Font>
+    {
+        [[nodiscard]] std::size_t operator()(const juce::Font& font) const noexcept;
+    };
+
+    template <>
+    struct hash<juce::AttributedString>
+    {
+        [[nodiscard]] std::size_t operator()(const juce::AttributedString& attributedString) const noexcept;
+    };
+} // namespace std
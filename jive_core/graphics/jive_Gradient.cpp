@@ -1,5 +1,6 @@
 #include "jive_Gradient.h"
 
+#include <jive_core/algorithms/jive_Hash.h>
 #include <jive_core/logging/jive_StringStreams.h>
 #include <jive_core/values/variant-converters/jive_VariantConvertion.h>
 
@@ -25,33 +26,39 @@ namespace jive
         for (const auto& stop : stops)
             gradient.addColour(stop.proportion, stop.colour);
 
+        const auto endPoints = getEndPoints(bounds);
+        gradient.point1 = endPoints.getStart();
+        gradient.point2 = endPoints.getEnd();
+
+        return gradient;
+    }
+
+    juce::Line<float> Gradient::getEndPoints(const juce::Rectangle<float>& bounds) const
+    {
         if (orientation.hasValue())
         {
             jassert(!startEndPoints.hasValue());
 
-            gradient.point1 = bounds.getTopLeft();
-
             switch (*orientation)
             {
             case Orientation::horizontal:
-                gradient.point2 = bounds.getTopRight();
-                break;
+                return { bounds.getTopLeft(), bounds.getTopRight() };
             case Orientation::vertical:
-                gradient.point2 = bounds.getBottomLeft();
-                break;
+                return { bounds.getTopLeft(), bounds.getBottomLeft() };
             }
         }
 
         if (startEndPoints.hasValue())
         {
-            jassert(!orientation.hasValue());
-
             const auto bottomRightRelative = bounds.getBottomRight() - bounds.getTopLeft();
-            gradient.point1 = bounds.getTopLeft() + startEndPoints->getStart() * bottomRightRelative;
-            gradient.point2 = bounds.getTopLeft() + startEndPoints->getEnd() * bottomRightRelative;
+
+            return {
+                bounds.getTopLeft() + startEndPoints->getStart() * bottomRightRelative,
+                bounds.getTopLeft() + startEndPoints->getEnd() * bottomRightRelative,
+            };
         }
 
-        return gradient;
+        return {};
     }
 
     bool Gradient::operator==(const Gradient& other) const
@@ -227,3 +234,32 @@ namespace juce
     }
     // LCOV_EXCL_STOP
 } // namespace juce
+
+namespace std
+{
+    std::size_t hash<jive::Gradient>::operator()(const jive::Gradient& gradient) const noexcept
+    {
+        auto seed = jive::hashAll(gradient.variant,
+                                  gradient.orientation.hasValue(),
+                                  gradient.startEndPoints.hasValue());
+
+        for (const auto& stop : gradient.stops)
+        {
+            jive::combineHash(seed, stop.proportion);
+            jive::combineHash(seed, stop.colour.getARGB());
+        }
+
+        if (gradient.orientation.hasValue())
+            jive::combineHash(seed, *gradient.orientation);
+
+        if (gradient.startEndPoints.hasValue())
+        {
+            jive::combineHash(seed, gradient.startEndPoints->getStartX());
+            jive::combineHash(seed, gradient.startEndPoints->getStartY());
+            jive::combineHash(seed, gradient.startEndPoints->getEndX());
+            jive::combineHash(seed, gradient.startEndPoints->getEndY());
+        }
+
+        return seed;
+    }
+} // namespace std
@@ -24,6 +24,7 @@ namespace jive
         };
 
         juce::ColourGradient toJuceGradient(const juce::Rectangle<float>& bounds) const;
+        juce::Line<float> getEndPoints(const juce::Rectangle<float>& bounds) const;
 
         bool operator==(const Gradient& other) const;
         bool operator!=(const Gradient& other) const;
@@ -61,3 +62,12 @@ namespace juce
     String& operator<<(String& str, const jive::Gradient::ColourStop& stop);
     String& operator<<(String& str, const jive::Gradient& gradient);
 } // namespace juce
+
+namespace std
+{
+    template <>
+    struct hash<jive::Gradient>
+    {
+        [[nodiscard]] std::size_t operator()(const jive::Gradient& gradient) const noexcept;
+    };
+} // namespace std
@@ -0,0 +1,149 @@
+#include "jive_GradientCache.h"
+
+namespace jive
+{
+    const juce::ColourGradient& GradientCache::getColourGradient(const Gradient& gradient,
+                                                                 const juce::Rectangle<float>& bounds)
+    {
+        if (cachedGradient.has_value() && *cachedGradient == gradient)
+        {
+            if (bounds != cachedBounds)
+            {
+                const auto endPoints = gradient.getEndPoints(bounds);
+                colourGradient.point1 = endPoints.getStart();
+                colourGradient.point2 = endPoints.getEnd();
+                cachedBounds = bounds;
+            }
+
+            return colourGradient;
+        }
+
+        if (canRecolourStopsFor(gradient))
+        {
+            for (auto i = 0; i < gradient.stops.size(); i++)
+                colourGradient.setColour(i, gradient.stops.getReference(i).colour);
+
+            const auto endPoints = gradient.getEndPoints(bounds);
+            colourGradient.point1 = endPoints.getStart();
+            colourGradient.point2 = endPoints.getEnd();
+            colourGradient.isRadial = gradient.variant == Gradient::Variant::radial;
+        }
+        else
+        {
+            colourGradient = gradient.toJuceGradient(bounds);
+        }
+
+        if (cachedGradient.has_value())
+        {
+            cachedGradient->stops.clearQuick();
+            cachedGradient->stops.addArray(gradient.stops);
+            cachedGradient->variant = gradient.variant;
+            cachedGradient->orientation = gradient.orientation;
+            cachedGradient->startEndPoints = gradient.startEndPoints;
+        }
+        else
+        {
+            cachedGradient = gradient;
+        }
+
+        cachedBounds = bounds;
+        return colourGradient;
+    }
+
+    bool GradientCache::canRecolourStopsFor(const Gradient& gradient) const
+    {
+        if (!cachedGradient.has_value())
+            return false;
+
+        if (cachedGradient->stops.size() != gradient.stops.size())
+            return false;
+
+        if (colourGradient.getNumColours() != gradient.stops.size())
+            return false;
+
+        for (auto i = 0; i < gradient.stops.size(); i++)
+        {
+            if (!juce::exactlyEqual(colourGradient.getColourPosition(i), gradient.stops.getReference(i).proportion))
+                return false;
+        }
+
+        return true;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+    #include <jive_core/logging/jive_StringStreams.h>
+
+class GradientCacheTest : public juce::UnitTest
+{
+public:
+    GradientCacheTest()
+        : juce::UnitTest{ "jive::GradientCache", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testBoundsChanges();
+        testColourChanges();
+        testStopChanges();
+    }
+
+private:
+    [[nodiscard]] static jive::Gradient createGradient()
+    {
+        jive::Gradient gradient;
+        gradient.stops.add({ 0.0, juce::Colours::red });
+        gradient.stops.add({ 1.0, juce::Colours::blue });
+        gradient.orientation = jive::Orientation::horizontal;
+        return gradient;
+    }
+
+    void testBoundsChanges()
+    {
+        beginTest("bounds changes");
+
+        jive::GradientCache cache;
+        const auto gradient = createGradient();
+
+        const auto& prepared = cache.getColourGradient(gradient, { 100.0f, 20.0f });
+        expect(prepared == gradient.toJuceGradient({ 100.0f, 20.0f }));
+
+        const auto& resized = cache.getColourGradient(gradient, { 200.0f, 20.0f });
+        expect(&resized == &prepared);
+        expectEquals(resized.point2, juce::Point<float>{ 200.0f, 0.0f });
+        expect(resized == gradient.toJuceGradient({ 200.0f, 20.0f }));
+    }
+
+    void testColourChanges()
+    {
+        beginTest("colour changes");
+
+        jive::GradientCache cache;
+        auto gradient = createGradient();
+        [[maybe_unused]] const auto& initial = cache.getColourGradient(gradient, { 100.0f, 20.0f });
+
+        gradient.stops.getReference(1).colour = juce::Colours::green;
+        const auto& recoloured = cache.getColourGradient(gradient, { 100.0f, 20.0f });
+        expectEquals(recoloured.getNumColours(), 2);
+        expectEquals(recoloured.getColour(1), juce::Colours::green);
+        expect(recoloured == gradient.toJuceGradient({ 100.0f, 20.0f }));
+    }
+
+    void testStopChanges()
+    {
+        beginTest("stop changes");
+
+        jive::GradientCache cache;
+        auto gradient = createGradient();
+        [[maybe_unused]] const auto& initial = cache.getColourGradient(gradient, { 100.0f, 20.0f });
+
+        gradient.stops.insert(1, { 0.5, juce::Colours::white });
+        const auto& rebuilt = cache.getColourGradient(gradient, { 100.0f, 20.0f });
+        expectEquals(rebuilt.getNumColours(), 3);
+        expect(rebuilt == gradient.toJuceGradient({ 100.0f, 20.0f }));
+    }
+};
+
+static GradientCacheTest gradientCacheTest;
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "jive_Gradient.h"
+
+namespace jive
+{
+    /** Holds the juce::ColourGradient last prepared for a Gradient.
+
+        Repeated paints with the same gradient and bounds return the prepared
+        gradient as-is. When only the bounds change, just the end points are
+        moved, and when only the stop colours change (as they do throughout an
+        animated transition) the existing stops are recoloured in place
+        instead of being rebuilt.
+    */
+    class GradientCache
+    {
+    public:
+        GradientCache() = default;
+
+        [[nodiscard]] const juce::ColourGradient& getColourGradient(const Gradient& gradient,
+                                                                    const juce::Rectangle<float>& bounds);
+
+    private:
+        [[nodiscard]] bool canRecolourStopsFor(const Gradient& gradient) const;
+
+        std::optional<Gradient> cachedGradient;
+        juce::Rectangle<float> cachedBounds;
+        juce::ColourGradient colourGradient;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GradientCache)
+    };
+} // namespace jive
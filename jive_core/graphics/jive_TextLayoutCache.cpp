@@ -0,0 +1,218 @@
+#include "jive_TextLayoutCache.h"
+
+#include <jive_core/algorithms/jive_Hash.h>
+#include <jive_core/graphics/jive_FontUtilities.h>
+
+namespace jive
+{
+    bool TextLayoutCache::Key::operator==(const Key& other) const
+    {
+        return layoutHash == other.layoutHash
+            && juce::exactlyEqual(maxWidth, other.maxWidth)
+            && haveSameLayout(*text, *other.text);
+    }
+
+    std::size_t TextLayoutCache::KeyHash::operator()(const Key& key) const noexcept
+    {
+        return hashAll(key.layoutHash, key.maxWidth);
+    }
+
+    TextLayoutCache::~TextLayoutCache()
+    {
+        clearSingletonInstance();
+    }
+
+    TextLayoutCache::SharedLayout TextLayoutCache::getLayout(const juce::AttributedString& text, float maxWidth)
+    {
+        return getLayout(text, hashLayout(text), maxWidth);
+    }
+
+    TextLayoutCache::SharedLayout TextLayoutCache::getLayout(const juce::AttributedString& text,
+                                                             std::size_t layoutHash,
+                                                             float maxWidth)
+    {
+        const Key key{ &text, layoutHash, maxWidth };
+
+        if (const auto existing = index.find(key);
+            existing != std::end(index))
+        {
+            entries.splice(std::begin(entries), entries, existing->second);
+            auto& entry = entries.front();
+
+            // Keep the most recent colours, as they're the most likely to be
+            // asked for again, e.g. during a colour transition
+            if (!areEqual(*entry.text, text))
+            {
+                auto layout = std::make_shared<juce::TextLayout>(*entry.layout);
+                recolour(*layout, text);
+
+                entry.layout = std::move(layout);
+                *entry.text = text;
+            }
+
+            return entry.layout;
+        }
+
+        auto layout = std::make_shared<juce::TextLayout>();
+        layout->createLayout(text, maxWidth);
+
+        if (maximumNumLayouts <= 0)
+            return layout;
+
+        // The stored key refers to the entry's own copy of the text, which
+        // outlives the caller's
+        auto storedText = std::make_unique<juce::AttributedString>(text);
+        auto storedKey = key;
+        storedKey.text = storedText.get();
+
+        entries.push_front(Entry{ std::move(storedText), storedKey, std::move(layout) });
+        index[storedKey] = std::begin(entries);
+        evictUntilWithin(maximumNumLayouts);
+
+        return entries.front().layout;
+    }
+
+    int TextLayoutCache::getMaximumNumLayouts() const
+    {
+        return maximumNumLayouts;
+    }
+
+    void TextLayoutCache::setMaximumNumLayouts(int newMaximum)
+    {
+        maximumNumLayouts = newMaximum;
+        evictUntilWithin(maximumNumLayouts);
+    }
+
+    int TextLayoutCache::getNumLayouts() const
+    {
+        return static_cast<int>(std::size(entries));
+    }
+
+    void TextLayoutCache::clear()
+    {
+        evictUntilWithin(0);
+    }
+
+    void TextLayoutCache::evictUntilWithin(int maximum)
+    {
+        while (getNumLayouts() > juce::jmax(0, maximum))
+        {
+            index.erase(entries.back().key);
+            entries.pop_back();
+        }
+    }
+
+    JUCE_IMPLEMENT_SINGLETON(TextLayoutCache)
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class TextLayoutCacheTest : public juce::UnitTest
+{
+public:
+    TextLayoutCacheTest()
+        : juce::UnitTest{ "jive::TextLayoutCache", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCaching();
+        testHashCollisions();
+        testRecolouring();
+        testEviction();
+    }
+
+private:
+    [[nodiscard]] static juce::AttributedString createText(const juce::String& content)
+    {
+        juce::AttributedString text;
+        text.append(content,
+                    juce::Font{
+#if JUCE_MAJOR_VERSION >= 8
+                        juce::FontOptions{},
+#endif
+                    });
+        return text;
+    }
+
+    void testCaching()
+    {
+        beginTest("caching");
+
+        jive::TextLayoutCache cache;
+        const auto text = createText("Lorem ipsum dolor sit amet");
+
+        const auto first = cache.getLayout(text, 100.0f);
+        const auto second = cache.getLayout(createText("Lorem ipsum dolor sit amet"), 100.0f);
+        expect(first == second);
+        expectEquals(cache.getNumLayouts(), 1);
+
+        const auto narrower = cache.getLayout(text, 50.0f);
+        expect(narrower != first);
+        expectGreaterOrEqual(narrower->getHeight(), first->getHeight());
+
+        const auto different = cache.getLayout(createText("Consectetur"), 100.0f);
+        expect(different != first);
+        expectEquals(cache.getNumLayouts(), 3);
+    }
+
+    void testHashCollisions()
+    {
+        beginTest("hash collisions");
+
+        jive::TextLayoutCache cache;
+        const auto first = createText("Lorem");
+        const auto second = createText("Lorem ipsum dolor sit amet");
+
+        // Pretend the two strings' hashes collide
+        const auto firstLayout = cache.getLayout(first, jive::hashLayout(first), 100.0f);
+        const auto secondLayout = cache.getLayout(second, jive::hashLayout(first), 100.0f);
+        expect(secondLayout != firstLayout);
+        expectEquals(cache.getNumLayouts(), 2);
+    }
+
+    void testRecolouring()
+    {
+        beginTest("recolouring");
+
+        jive::TextLayoutCache cache;
+        auto text = createText("Lorem ipsum dolor sit amet");
+        text.setColour(juce::Colours::red);
+        const auto red = cache.getLayout(text, 50.0f);
+
+        text.setColour(juce::Colours::blue);
+        const auto blue = cache.getLayout(text, 50.0f);
+        expectEquals(cache.getNumLayouts(), 1);
+        expectEquals(blue->getNumLines(), red->getNumLines());
+
+        for (auto i = 0; i < blue->getNumLines(); i++)
+        {
+            for (const auto* run : blue->getLine(i).runs)
+                expect(run->colour == juce::Colours::blue);
+        }
+
+        expect(red->getLine(0).runs.getFirst()->colour == juce::Colours::red);
+        expect(cache.getLayout(text, 50.0f) == blue);
+    }
+
+    void testEviction()
+    {
+        beginTest("eviction");
+
+        jive::TextLayoutCache cache;
+        cache.setMaximumNumLayouts(2);
+        const auto text = createText("Lorem ipsum");
+
+        const auto first = cache.getLayout(text, 10.0f);
+        [[maybe_unused]] const auto second = cache.getLayout(text, 20.0f);
+        [[maybe_unused]] const auto third = cache.getLayout(text, 30.0f);
+        expectEquals(cache.getNumLayouts(), 2);
+        expect(cache.getLayout(text, 10.0f) != first);
+
+        cache.clear();
+        expectEquals(cache.getNumLayouts(), 0);
+    }
+};
+
+static TextLayoutCacheTest textLayoutCacheTest;
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+
+#include <list>
+
+namespace jive
+{
+    /** A process-wide LRU cache of shaped text layouts.
+
+        Layouts are keyed by everything that affects how an attributed string
+        is laid out (its text, fonts and paragraph settings) along with the
+        maximum width it was laid out in, so repeated measurement passes and
+        paints of the same text at the same width only shape it once. Each
+        entry keeps a copy of its string, which is compared in full on lookup.
+
+        Colours don't affect the layout, so a string that only differs in its
+        colours reuses the shaped glyphs and only has its runs recoloured.
+    */
+    class TextLayoutCache : private juce::DeletedAtShutdown
+    {
+    public:
+        using SharedLayout = std::shared_ptr<const juce::TextLayout>;
+
+        TextLayoutCache() = default;
+        ~TextLayoutCache() override;
+
+        [[nodiscard]] SharedLayout getLayout(const juce::AttributedString& text, float maxWidth);
+
+        /** Returns the layout for the given text, where layoutHash is the
+            result of hashLayout(text).
+        */
+        [[nodiscard]] SharedLayout getLayout(const juce::AttributedString& text,
+                                             std::size_t layoutHash,
+                                             float maxWidth);
+
+        [[nodiscard]] int getMaximumNumLayouts() const;
+        void setMaximumNumLayouts(int newMaximum);
+
+        [[nodiscard]] int getNumLayouts() const;
+        void clear();
+
+        static constexpr int defaultMaximumNumLayouts = 1024;
+
+        JUCE_DECLARE_SINGLETON(TextLayoutCache, false)
+
+    private:
+        struct Key
+        {
+            [[nodiscard]] bool operator==(const Key& other) const;
+
+            const juce::AttributedString* text{ nullptr };
+            std::size_t layoutHash{ 0 };
+            float maxWidth{ 0.0f };
+        };
+
+        struct KeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const Key& key) const noexcept;
+        };
+
+        struct Entry
+        {
+            std::unique_ptr<juce::AttributedString> text;
+            Key key;
+            SharedLayout layout;
+        };
+
+        void evictUntilWithin(int maximum);
+
+        std::list<Entry> entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+        int maximumNumLayouts{ defaultMaximumNumLayouts };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TextLayoutCache)
+    };
+} // namespace jive
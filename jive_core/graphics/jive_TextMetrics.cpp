@@ -0,0 +1,167 @@
+#include "jive_TextMetrics.h"
+
+#include <jive_core/graphics/jive_FontUtilities.h>
+
+namespace jive
+{
+    TextMetrics::TextMetrics(const juce::AttributedString& attributedString)
+        : TextMetrics{ attributedString, hashLayout(attributedString) }
+    {
+    }
+
+    TextMetrics::TextMetrics(const juce::AttributedString& attributedString, std::size_t hash)
+        : text{ attributedString }
+        , layoutHash{ hash }
+        , maxContentLayout{ TextLayoutCache::getInstance()->getLayout(text, layoutHash, unconstrainedWidth) }
+    {
+        addLineBreakRange(*maxContentLayout, unconstrainedWidth);
+    }
+
+    std::size_t TextMetrics::getLayoutHash() const
+    {
+        return layoutHash;
+    }
+
+    float TextMetrics::getMaxContentWidth() const
+    {
+        return maxContentLayout->getWidth();
+    }
+
+    float TextMetrics::getMaxContentHeight() const
+    {
+        return maxContentLayout->getHeight();
+    }
+
+    float TextMetrics::getMinContentWidth()
+    {
+        if (!minContentWidth.has_value())
+        {
+            static constexpr auto narrowestWidth = 1.0f;
+            const auto layout = TextLayoutCache::getInstance()->getLayout(text, layoutHash, narrowestWidth);
+            minContentWidth = juce::jmin(layout->getWidth(), getMaxContentWidth());
+        }
+
+        return *minContentWidth;
+    }
+
+    float TextMetrics::getHeightForWidth(float width)
+    {
+        const auto range = std::upper_bound(std::begin(lineBreakRanges),
+                                            std::end(lineBreakRanges),
+                                            width,
+                                            [](float value, const LineBreakRange& lineBreakRange) {
+                                                return value < lineBreakRange.minWidth;
+                                            });
+
+        if (range != std::begin(lineBreakRanges) && width <= std::prev(range)->maxWidth)
+            return std::prev(range)->height;
+
+        return getLayout(width)->getHeight();
+    }
+
+    TextLayoutCache::SharedLayout TextMetrics::getLayout(float width)
+    {
+        if (width >= getMaxContentWidth())
+            return maxContentLayout;
+
+        auto layout = TextLayoutCache::getInstance()->getLayout(text, layoutHash, width);
+        addLineBreakRange(*layout, width);
+
+        return layout;
+    }
+
+    int TextMetrics::getNumLineBreakRanges() const
+    {
+        return static_cast<int>(std::size(lineBreakRanges));
+    }
+
+    void TextMetrics::addLineBreakRange(const juce::TextLayout& layout, float width)
+    {
+        if (layout.getWidth() > width)
+            return;
+
+        const LineBreakRange range{ layout.getWidth(), width, layout.getHeight() };
+        const auto position = std::lower_bound(std::begin(lineBreakRanges),
+                                               std::end(lineBreakRanges),
+                                               range,
+                                               [](const LineBreakRange& a, const LineBreakRange& b) {
+                                                   return a.minWidth < b.minWidth;
+                                               });
+
+        if (position != std::end(lineBreakRanges) && juce::exactlyEqual(position->minWidth, range.minWidth))
+        {
+            position->maxWidth = juce::jmax(position->maxWidth, range.maxWidth);
+            return;
+        }
+
+        lineBreakRanges.insert(position, range);
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class TextMetricsTest : public juce::UnitTest
+{
+public:
+    TextMetricsTest()
+        : juce::UnitTest{ "jive::TextMetrics", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testContentSizes();
+        testHeightForWidth();
+    }
+
+private:
+    [[nodiscard]] static juce::AttributedString createText()
+    {
+        juce::AttributedString text;
+        text.append("Lorem ipsum dolor sit amet, consectetur adipiscing elit.",
+                    juce::Font{
+#if JUCE_MAJOR_VERSION >= 8
+                        juce::FontOptions{},
+#endif
+                    });
+        return text;
+    }
+
+    [[nodiscard]] static juce::TextLayout createLayout(float width)
+    {
+        juce::TextLayout layout;
+        layout.createLayout(createText(), width);
+        return layout;
+    }
+
+    void testContentSizes()
+    {
+        beginTest("content sizes");
+
+        jive::TextMetrics metrics{ createText() };
+        expectEquals(metrics.getMaxContentWidth(), createLayout(jive::TextMetrics::unconstrainedWidth).getWidth());
+        expectEquals(metrics.getMaxContentHeight(), createLayout(jive::TextMetrics::unconstrainedWidth).getHeight());
+        expectEquals(metrics.getMinContentWidth(), createLayout(1.0f).getWidth());
+        expectLessThan(metrics.getMinContentWidth(), metrics.getMaxContentWidth());
+    }
+
+    void testHeightForWidth()
+    {
+        beginTest("height for width");
+
+        jive::TextMetrics metrics{ createText() };
+        expectEquals(metrics.getNumLineBreakRanges(), 1);
+
+        for (const auto width : { 500.0f, 120.0f, 100.0f, 80.0f, 60.0f, 40.0f })
+            expectEquals(metrics.getHeightForWidth(width), createLayout(width).getHeight());
+
+        const auto numRanges = metrics.getNumLineBreakRanges();
+
+        for (const auto width : { 500.0f, 120.0f, 100.0f, 80.0f, 60.0f, 40.0f })
+            expectEquals(metrics.getHeightForWidth(width), createLayout(width).getHeight());
+
+        expectEquals(metrics.getNumLineBreakRanges(), numRanges);
+    }
+};
+
+static TextMetricsTest textMetricsTest;
+#endif
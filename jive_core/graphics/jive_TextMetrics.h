@@ -0,0 +1,54 @@
+#pragma once
+
+#include "jive_TextLayoutCache.h"
+
+namespace jive
+{
+    /** Intrinsic sizes of a single attributed string.
+
+        The max-content size (the text laid out without wrapping) is measured
+        up front. Every other layout measured through getHeightForWidth() is
+        recorded as the range of widths it stays valid for: any width between
+        the layout's widest line and the width it was created with produces
+        exactly the same line breaks. Later queries binary-search those ranges
+        and only shape the text again for widths that fall outside all of
+        them.
+    */
+    class TextMetrics
+    {
+    public:
+        explicit TextMetrics(const juce::AttributedString& text);
+        TextMetrics(const juce::AttributedString& text, std::size_t layoutHash);
+
+        [[nodiscard]] std::size_t getLayoutHash() const;
+
+        [[nodiscard]] float getMaxContentWidth() const;
+        [[nodiscard]] float getMaxContentHeight() const;
+        [[nodiscard]] float getMinContentWidth();
+
+        [[nodiscard]] float getHeightForWidth(float width);
+        [[nodiscard]] TextLayoutCache::SharedLayout getLayout(float width);
+
+        [[nodiscard]] int getNumLineBreakRanges() const;
+
+        static constexpr float unconstrainedWidth = static_cast<float>(std::numeric_limits<juce::uint16>::max());
+
+    private:
+        struct LineBreakRange
+        {
+            float minWidth;
+            float maxWidth;
+            float height;
+        };
+
+        void addLineBreakRange(const juce::TextLayout& layout, float width);
+
+        juce::AttributedString text;
+        std::size_t layoutHash;
+        TextLayoutCache::SharedLayout maxContentLayout;
+        std::optional<float> minContentWidth;
+        std::vector<LineBreakRange> lineBreakRanges;
+
+        JUCE_LEAK_DETECTOR(TextMetrics)
+    };
+} // namespace jive
@@ -4,13 +4,22 @@
 #include "logging/jive_ScopeIndentedLogger.cpp"
 #include "logging/jive_StringStreams.cpp"
 
+#include "profiling/jive_Instrumentation.cpp"
+#include "profiling/jive_PerformanceCounters.cpp"
+#include "profiling/jive_Profiler.cpp"
+
 #include "algorithms/jive_Find.cpp"
 #include "algorithms/jive_Interpolate.cpp"
 
+#include "memory/jive_BlockPool.cpp"
+
+#include "values/jive_BinaryView.cpp"
 #include "values/jive_Colours.cpp"
 #include "values/jive_Event.cpp"
 #include "values/jive_Object.cpp"
 #include "values/jive_Property.cpp"
+#include "values/jive_PropertyDispatcher.cpp"
+#include "values/jive_PropertyTransaction.cpp"
 #include "values/jive_XmlParser.cpp"
 #include "values/variant-converters/jive_AttributedStringVariantConverters.cpp"
 #include "values/variant-converters/jive_FlexVariantConverters.cpp"
@@ -22,9 +31,13 @@
 #include "geometry/jive_Orientation.cpp"
 
 #include "graphics/jive_Fill.cpp"
+#include "graphics/jive_FontCache.cpp"
 #include "graphics/jive_FontUtilities.cpp"
 #include "graphics/jive_Gradient.cpp"
+#include "graphics/jive_GradientCache.cpp"
 #include "graphics/jive_LookAndFeel.cpp"
+#include "graphics/jive_TextLayoutCache.cpp"
+#include "graphics/jive_TextMetrics.cpp"
 
 #include "interface/jive_ComponentInteractionState.cpp"
 
@@ -16,22 +16,33 @@ END_JUCE_MODULE_DECLARATION */
 #include "logging/jive_ScopeIndentedLogger.h"
 #include "logging/jive_StringStreams.h"
 
+#include "profiling/jive_Instrumentation.h"
+#include "profiling/jive_PerformanceCounters.h"
+#include "profiling/jive_Profiler.h"
+
 #include "algorithms/jive_Find.h"
+#include "algorithms/jive_Hash.h"
 #include "algorithms/jive_Interpolate.h"
 #include "algorithms/jive_TransferFunction.h"
 #include "algorithms/jive_Visitor.h"
 
 #include "algorithms/jive_Bezier.h"
 
+#include "memory/jive_BlockPool.h"
+
 #include "kinetics/jive_Easing.h"
 #include "time/jive_TimeParser.h"
 #include "time/jive_Timer.h"
 #include "values/jive_PropertyBehaviours.h"
 
+#include "values/jive_BinaryView.h"
 #include "values/jive_Colours.h"
 #include "values/jive_Event.h"
 #include "values/jive_Object.h"
 #include "values/jive_Property.h"
+#include "values/jive_PropertyCallback.h"
+#include "values/jive_PropertyDispatcher.h"
+#include "values/jive_PropertyTransaction.h"
 #include "values/jive_ReferenceCountedValueTreeWrapper.h"
 #include "values/jive_XmlParser.h"
 #include "values/variant-converters/jive_AttributedStringVariantConverters.h"
@@ -48,9 +59,13 @@ END_JUCE_MODULE_DECLARATION */
 
 #include "graphics/jive_FontUtilities.h"
 #include "graphics/jive_Gradient.h"
+#include "graphics/jive_GradientCache.h"
 #include "graphics/jive_LookAndFeel.h"
+#include "graphics/jive_TextLayoutCache.h"
+#include "graphics/jive_TextMetrics.h"
 
 #include "graphics/jive_Fill.h"
+#include "graphics/jive_FontCache.h"
 
 #include "interface/jive_ComponentInteractionState.h"
 
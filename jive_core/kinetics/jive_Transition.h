@@ -16,7 +16,7 @@ namespace jive
         {
             virtual ~Listener() = default;
 
-            virtual void transitionProgressed(const juce::String& propertyName,
+            virtual void transitionProgressed(const juce::Identifier& propertyName,
                                               const Transition& transition) = 0;
         };
 
@@ -10,7 +10,7 @@ namespace jive
         return static_cast<int>(std::size(transitions));
     }
 
-    Transition* Transitions::operator[](const juce::String& propertyName)
+    Transition* Transitions::operator[](const juce::Identifier& propertyName)
     {
         if (const auto keyValuePair = transitions.find(propertyName);
             keyValuePair != std::end(transitions))
@@ -33,7 +33,7 @@ namespace jive
             if (const auto transition = Transition::fromString(transitionString);
                 transition.has_value())
             {
-                const auto propertyName = transitionString.upToFirstOccurrenceOf(" ", false, true);
+                const juce::Identifier propertyName{ transitionString.upToFirstOccurrenceOf(" ", false, true) };
                 object->transitions[propertyName] = *transition;
             }
         }
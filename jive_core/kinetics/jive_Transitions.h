@@ -3,6 +3,7 @@
 #include "jive_Easing.h"
 #include "jive_Transition.h"
 
+#include <jive_core/algorithms/jive_Hash.h>
 #include <jive_core/algorithms/jive_Interpolate.h>
 #include <jive_core/time/jive_Timer.h>
 #include <jive_core/values/jive_PropertyBehaviours.h>
@@ -16,7 +17,7 @@ namespace jive
 
         [[nodiscard]] int size() const;
 
-        [[nodiscard]] Transition* operator[](const juce::String& propertyName);
+        [[nodiscard]] Transition* operator[](const juce::Identifier& propertyName);
 
         [[nodiscard]] static ReferenceCountedPointer fromString(const juce::String& s);
 
@@ -41,7 +42,7 @@ namespace jive
             }
         }
 
-        std::unordered_map<juce::String, Transition> transitions;
+        std::unordered_map<juce::Identifier, Transition> transitions;
         const Timer transitionsUpdater{
             std::bind(&Transitions::updateTransitions, this),
             juce::RelativeTime::seconds(1.0 / 60.0),
@@ -0,0 +1,297 @@
+#include "jive_BlockPool.h"
+
+namespace jive
+{
+    struct BlockPool::Chunk
+    {
+        std::size_t sizeClass;
+        std::size_t numLiveBlocks;
+        std::size_t position;
+        FreeBlock* freeList;
+        Chunk* previous;
+        Chunk* next;
+        bool isAvailable;
+    };
+
+    // Chunks are aligned to their size, so a block's chunk can be found by
+    // masking its address
+    static constexpr std::align_val_t chunkAlignment{ BlockPool::chunkSize };
+
+    [[nodiscard]] static std::size_t getSizeClass(std::size_t size) noexcept
+    {
+        return juce::jmax(std::size_t{ 1 }, (size + BlockPool::blockAlignment - 1) / BlockPool::blockAlignment);
+    }
+
+    BlockPool::~BlockPool()
+    {
+        // Blocks are still in use!
+        jassert(numLiveBlocks == 0);
+
+        if (spareChunk != nullptr)
+            ::operator delete(spareChunk, chunkAlignment);
+    }
+
+    void* BlockPool::allocate(std::size_t size)
+    {
+        if (size > maxBlockSize)
+            return ::operator new(size);
+
+        const auto sizeClass = getSizeClass(size);
+        const auto blockSize = sizeClass * blockAlignment;
+
+        const juce::SpinLock::ScopedLockType scopedLock{ lock };
+
+        auto* chunk = availableChunks[sizeClass - 1];
+
+        if (chunk == nullptr)
+            chunk = &createChunk(sizeClass);
+
+        void* block = nullptr;
+
+        if (auto* const freeBlock = chunk->freeList; freeBlock != nullptr)
+        {
+            chunk->freeList = freeBlock->next;
+            block = freeBlock;
+        }
+        else
+        {
+            block = reinterpret_cast<std::byte*>(chunk) + chunk->position;
+            chunk->position += blockSize;
+        }
+
+        chunk->numLiveBlocks++;
+        numLiveBlocks++;
+
+        if (chunk->freeList == nullptr && chunk->position + blockSize > chunkSize)
+            makeUnavailable(*chunk);
+
+        return block;
+    }
+
+    void BlockPool::deallocate(void* block, std::size_t size) noexcept
+    {
+        if (block == nullptr)
+            return;
+
+        if (size > maxBlockSize)
+        {
+            ::operator delete(block);
+            return;
+        }
+
+        auto* const chunk = reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(block) & ~(chunkSize - 1));
+
+        const juce::SpinLock::ScopedLockType scopedLock{ lock };
+        jassert(numLiveBlocks > 0 && chunk->numLiveBlocks > 0);
+        jassert(chunk->sizeClass == getSizeClass(size));
+
+        chunk->freeList = new (block) FreeBlock{ chunk->freeList };
+        numLiveBlocks--;
+
+        if (--chunk->numLiveBlocks == 0)
+            releaseChunk(*chunk);
+        else if (!chunk->isAvailable)
+            makeAvailable(*chunk);
+    }
+
+    std::size_t BlockPool::getNumLiveBlocks() const noexcept
+    {
+        const juce::SpinLock::ScopedLockType scopedLock{ lock };
+        return numLiveBlocks;
+    }
+
+    std::size_t BlockPool::getNumChunks() const noexcept
+    {
+        const juce::SpinLock::ScopedLockType scopedLock{ lock };
+        return numChunks;
+    }
+
+    BlockPool& BlockPool::getItemPool()
+    {
+        static auto* const pool = new BlockPool;
+        return *pool;
+    }
+
+    BlockPool::Chunk& BlockPool::createChunk(std::size_t sizeClass)
+    {
+        static constexpr auto headerSize = (sizeof(Chunk) + blockAlignment - 1) / blockAlignment * blockAlignment;
+
+        void* memory = std::exchange(spareChunk, nullptr);
+
+        if (memory == nullptr)
+        {
+            memory = ::operator new(chunkSize, chunkAlignment);
+            numChunks++;
+        }
+
+        auto* const chunk = new (memory) Chunk{ sizeClass, 0, headerSize, nullptr, nullptr, nullptr, false };
+        makeAvailable(*chunk);
+
+        return *chunk;
+    }
+
+    void BlockPool::releaseChunk(Chunk& chunk) noexcept
+    {
+        if (chunk.isAvailable)
+            makeUnavailable(chunk);
+
+        if (spareChunk != nullptr)
+        {
+            ::operator delete(spareChunk, chunkAlignment);
+            numChunks--;
+        }
+
+        spareChunk = &chunk;
+    }
+
+    void BlockPool::makeAvailable(Chunk& chunk) noexcept
+    {
+        auto*& head = availableChunks[chunk.sizeClass - 1];
+
+        chunk.previous = nullptr;
+        chunk.next = head;
+
+        if (head != nullptr)
+            head->previous = &chunk;
+
+        head = &chunk;
+        chunk.isAvailable = true;
+    }
+
+    void BlockPool::makeUnavailable(Chunk& chunk) noexcept
+    {
+        if (chunk.previous != nullptr)
+            chunk.previous->next = chunk.next;
+        else
+            availableChunks[chunk.sizeClass - 1] = chunk.next;
+
+        if (chunk.next != nullptr)
+            chunk.next->previous = chunk.previous;
+
+        chunk.previous = nullptr;
+        chunk.next = nullptr;
+        chunk.isAvailable = false;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class BlockPoolUnitTest : public juce::UnitTest
+{
+public:
+    BlockPoolUnitTest()
+        : juce::UnitTest{ "jive::BlockPool", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testReusingBlocks();
+        testSizeClasses();
+        testLargeBlocks();
+        testReleasingChunks();
+    }
+
+private:
+    void testReusingBlocks()
+    {
+        beginTest("reusing blocks");
+
+        jive::BlockPool pool;
+        auto* const first = pool.allocate(100);
+        expect(first != nullptr);
+        expectEquals(static_cast<int>(pool.getNumLiveBlocks()), 1);
+
+        auto* const second = pool.allocate(100);
+        expect(second != first);
+        pool.deallocate(second, 100);
+        expectEquals(static_cast<int>(pool.getNumLiveBlocks()), 1);
+
+        expect(pool.allocate(100) == second);
+        pool.deallocate(second, 100);
+        pool.deallocate(first, 100);
+        expectEquals(static_cast<int>(pool.getNumLiveBlocks()), 0);
+    }
+
+    void testSizeClasses()
+    {
+        beginTest("size classes");
+
+        jive::BlockPool pool;
+        std::vector<std::pair<void*, std::size_t>> blocks;
+
+        for (const std::size_t size : { 1, 8, 16, 24, 100, 1000, 4096 })
+        {
+            auto* const block = pool.allocate(size);
+            expect(reinterpret_cast<std::uintptr_t>(block) % jive::BlockPool::blockAlignment == 0);
+            std::memset(block, 0xff, size);
+            blocks.emplace_back(block, size);
+        }
+
+        // A freed block is only reused for allocations of the same class
+        auto* const small = pool.allocate(16);
+        pool.deallocate(small, 16);
+        auto* const larger = pool.allocate(32);
+        expect(larger != small);
+        expect(pool.allocate(9) == small);
+
+        pool.deallocate(larger, 32);
+        pool.deallocate(small, 9);
+
+        for (const auto& [block, size] : blocks)
+            pool.deallocate(block, size);
+
+        expectEquals(static_cast<int>(pool.getNumLiveBlocks()), 0);
+    }
+
+    void testLargeBlocks()
+    {
+        beginTest("large blocks");
+
+        jive::BlockPool pool;
+        auto* const block = pool.allocate(jive::BlockPool::maxBlockSize + 1);
+        expect(block != nullptr);
+        expectEquals(static_cast<int>(pool.getNumLiveBlocks()), 0);
+        expectEquals(static_cast<int>(pool.getNumChunks()), 0);
+
+        pool.deallocate(block, jive::BlockPool::maxBlockSize + 1);
+    }
+
+    void testReleasingChunks()
+    {
+        beginTest("releasing chunks");
+
+        jive::BlockPool pool;
+        std::vector<void*> blocks;
+
+        for (auto i = 0; i < 100; i++)
+            blocks.push_back(pool.allocate(2048));
+
+        expectGreaterThan(static_cast<int>(pool.getNumChunks()), 2);
+
+        // Each chunk is released as soon as its last block is freed, while
+        // blocks in other chunks are still alive
+        const auto numChunks = pool.getNumChunks();
+
+        for (auto i = 0; i < 50; i++)
+            pool.deallocate(blocks[static_cast<std::size_t>(i)], 2048);
+
+        expectGreaterThan(static_cast<int>(pool.getNumLiveBlocks()), 0);
+        expectLessThan(static_cast<int>(pool.getNumChunks()), static_cast<int>(numChunks));
+
+        for (auto i = 50; i < 100; i++)
+            pool.deallocate(blocks[static_cast<std::size_t>(i)], 2048);
+
+        // Only the spare chunk is left
+        expectEquals(static_cast<int>(pool.getNumLiveBlocks()), 0);
+        expectEquals(static_cast<int>(pool.getNumChunks()), 1);
+
+        // The spare is reused rather than allocating a new chunk
+        auto* const block = pool.allocate(2048);
+        expectEquals(static_cast<int>(pool.getNumChunks()), 1);
+        pool.deallocate(block, 2048);
+        expectEquals(static_cast<int>(pool.getNumChunks()), 1);
+    }
+};
+
+static BlockPoolUnitTest blockPoolUnitTest;
+#endif
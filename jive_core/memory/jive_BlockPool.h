@@ -0,0 +1,77 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace jive
+{
+    /** Allocates small blocks of memory from a few large chunks, rather than
+        making a separate heap allocation for each one.
+
+        Blocks are grouped into size classes, and each chunk only holds blocks
+        of a single class. A freed block goes back on its chunk's free list,
+        and the next allocation of the same class reuses it. This makes
+        creating and destroying many objects of the same few sizes much
+        cheaper, and stops them fragmenting the heap.
+
+        Every chunk counts its live blocks, and is released as soon as the
+        last of them is freed, so tearing down a view gives its memory back
+        even while other views are still alive. The most recently emptied
+        chunk is kept as a spare, so a single block being allocated and freed
+        over and over doesn't allocate a new chunk each time.
+
+        Blocks larger than maxBlockSize are passed straight to the global
+        operator new.
+    */
+    class BlockPool
+    {
+    public:
+        BlockPool() = default;
+        ~BlockPool();
+
+        [[nodiscard]] void* allocate(std::size_t size);
+        void deallocate(void* block, std::size_t size) noexcept;
+
+        [[nodiscard]] std::size_t getNumLiveBlocks() const noexcept;
+
+        /** Returns the number of chunks currently allocated, including the
+            spare.
+        */
+        [[nodiscard]] std::size_t getNumChunks() const noexcept;
+
+        /** The pool shared by the GUI items, style sheets and property
+            transitions of every view.
+
+            It's never destroyed, so items destroyed during static
+            destruction can still return their blocks.
+        */
+        [[nodiscard]] static BlockPool& getItemPool();
+
+        static constexpr std::size_t blockAlignment = alignof(std::max_align_t);
+        static constexpr std::size_t maxBlockSize = 4096;
+        static constexpr std::size_t chunkSize = 16 * 1024;
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct Chunk;
+
+        static constexpr auto numSizeClasses = maxBlockSize / blockAlignment;
+
+        [[nodiscard]] Chunk& createChunk(std::size_t sizeClass);
+        void releaseChunk(Chunk& chunk) noexcept;
+        void makeAvailable(Chunk& chunk) noexcept;
+        void makeUnavailable(Chunk& chunk) noexcept;
+
+        // The chunks of each size class that have room for another block
+        std::array<Chunk*, numSizeClasses> availableChunks{};
+        void* spareChunk{ nullptr };
+        std::size_t numChunks{ 0 };
+        std::size_t numLiveBlocks{ 0 };
+        juce::SpinLock lock;
+
+        JUCE_DECLARE_NON_COPYABLE(BlockPool)
+    };
+} // namespace jive
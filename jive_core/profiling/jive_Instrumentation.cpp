@@ -0,0 +1,131 @@
+#include "jive_Instrumentation.h"
+
+namespace jive
+{
+    static std::array<std::atomic<juce::int64>, Instrumentation::numCounters> instrumentationCounters{};
+
+    void Instrumentation::add(Counter counter, juce::int64 amount) noexcept
+    {
+        instrumentationCounters[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    juce::int64 Instrumentation::get(Counter counter) noexcept
+    {
+        return instrumentationCounters[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed);
+    }
+
+    Instrumentation::Snapshot Instrumentation::takeSnapshot() noexcept
+    {
+        Snapshot snapshot{};
+
+        for (std::size_t i = 0; i < numCounters; i++)
+            snapshot[i] = instrumentationCounters[i].load(std::memory_order_relaxed);
+
+        return snapshot;
+    }
+
+    const char* Instrumentation::getName(Counter counter) noexcept
+    {
+        switch (counter)
+        {
+        case Counter::allocations:
+            return "allocations";
+        case Counter::deallocations:
+            return "deallocations";
+        case Counter::allocatedBytes:
+            return "allocated-bytes";
+        case Counter::deallocatedBytes:
+            return "deallocated-bytes";
+        case Counter::propertiesCreated:
+            return "properties-created";
+        case Counter::propertiesDestroyed:
+            return "properties-destroyed";
+        case Counter::valueTreeListenersAdded:
+            return "value-tree-listeners-added";
+        case Counter::valueTreeListenersRemoved:
+            return "value-tree-listeners-removed";
+        case Counter::styleSheetsCreated:
+            return "style-sheets-created";
+        case Counter::styleSheetsDestroyed:
+            return "style-sheets-destroyed";
+        case Counter::guiItemsCreated:
+            return "gui-items-created";
+        case Counter::guiItemsDestroyed:
+            return "gui-items-destroyed";
+        case Counter::numCounters:
+            break;
+        }
+
+        jassertfalse;
+        return "";
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+    #include <jive_core/interface/jive_ComponentInteractionState.h>
+
+class InstrumentationTest : public juce::UnitTest
+{
+public:
+    InstrumentationTest()
+        : juce::UnitTest{ "jive::Instrumentation", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCounters();
+        testValueTreeListeners();
+    }
+
+private:
+    void testCounters()
+    {
+        beginTest("counters");
+
+        using Counter = jive::Instrumentation::Counter;
+
+        const auto before = jive::Instrumentation::takeSnapshot();
+        jive::Instrumentation::add(Counter::guiItemsCreated, 3);
+        const auto after = jive::Instrumentation::takeSnapshot();
+
+        const auto index = static_cast<std::size_t>(Counter::guiItemsCreated);
+        expectEquals(after[index] - before[index], juce::int64{ 3 });
+        expectEquals(jive::Instrumentation::get(Counter::guiItemsCreated), after[index]);
+        expectEquals(juce::String{ jive::Instrumentation::getName(Counter::guiItemsCreated) },
+                     juce::String{ "gui-items-created" });
+    }
+
+    void testValueTreeListeners()
+    {
+        beginTest("value tree listeners");
+
+        if (!jive::Instrumentation::isEnabled)
+            return;
+
+        using Counter = jive::Instrumentation::Counter;
+
+        const auto getChange = [](const auto& before, const auto& after, Counter counter) {
+            const auto index = static_cast<std::size_t>(counter);
+            return after[index] - before[index];
+        };
+
+        juce::Component component;
+        juce::ValueTree tree{ "Component" };
+        const auto before = jive::Instrumentation::takeSnapshot();
+        {
+            const jive::ComponentInteractionState interactionState{ component, tree };
+            const jive::Property<int> property{ tree, "value" };
+
+            const auto during = jive::Instrumentation::takeSnapshot();
+            expectGreaterThan(static_cast<int>(getChange(before, during, Counter::valueTreeListenersAdded)), 2);
+        }
+        const auto after = jive::Instrumentation::takeSnapshot();
+
+        expectEquals(getChange(before, after, Counter::valueTreeListenersAdded),
+                     getChange(before, after, Counter::valueTreeListenersRemoved));
+    }
+};
+
+static InstrumentationTest instrumentationTest;
+#endif
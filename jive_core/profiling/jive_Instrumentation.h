@@ -0,0 +1,62 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#ifndef JIVE_INSTRUMENTATION
+    #define JIVE_INSTRUMENTATION 0
+#endif
+
+#if JIVE_INSTRUMENTATION
+    #define JIVE_INSTRUMENT(counter, amount) \
+        jive::Instrumentation::add(jive::Instrumentation::Counter::counter, static_cast<juce::int64>(amount))
+#else
+    #define JIVE_INSTRUMENT(counter, amount)
+#endif
+
+namespace jive
+{
+    /** Process-wide counters for the operations that drive JIVE's cost more
+        than CPU time does: heap allocations, ValueTree listener registrations
+        and the number of Properties, StyleSheets and GuiItems created.
+
+        Listener registrations count both listeners added to a ValueTree and
+        listeners added for a single property through a PropertyDispatcher,
+        which is how Properties, and so most of JIVE, listen to their trees.
+
+        The counters are only updated when JIVE_INSTRUMENTATION is enabled,
+        in which case the JIVE_INSTRUMENT macro compiles to a relaxed atomic
+        increment. Allocations are only counted if the application replaces
+        the global operator new and delete to call JIVE_INSTRUMENT, as the
+        benchmarking runner does.
+    */
+    struct Instrumentation
+    {
+        enum class Counter
+        {
+            allocations,
+            deallocations,
+            allocatedBytes,
+            deallocatedBytes,
+            propertiesCreated,
+            propertiesDestroyed,
+            valueTreeListenersAdded,
+            valueTreeListenersRemoved,
+            styleSheetsCreated,
+            styleSheetsDestroyed,
+            guiItemsCreated,
+            guiItemsDestroyed,
+
+            numCounters,
+        };
+
+        static constexpr auto numCounters = static_cast<std::size_t>(Counter::numCounters);
+        using Snapshot = std::array<juce::int64, numCounters>;
+
+        static void add(Counter counter, juce::int64 amount) noexcept;
+        [[nodiscard]] static juce::int64 get(Counter counter) noexcept;
+        [[nodiscard]] static Snapshot takeSnapshot() noexcept;
+        [[nodiscard]] static const char* getName(Counter counter) noexcept;
+
+        static constexpr bool isEnabled = JIVE_INSTRUMENTATION;
+    };
+} // namespace jive
@@ -0,0 +1,196 @@
+#include "jive_PerformanceCounters.h"
+
+namespace jive
+{
+    static std::atomic<bool> performanceCountersEnabled{ false };
+    static thread_local PerformanceCounters::ScopedLayoutTimer* innermostLayoutTimer = nullptr;
+
+    PerformanceCounters::ScopedLayoutTimer::ScopedLayoutTimer(PerformanceCounters& countersToUpdate)
+        : counters{ isEnabled() ? &countersToUpdate : nullptr }
+        , enclosingTimer{ counters != nullptr ? innermostLayoutTimer : nullptr }
+        , startTicks{ counters != nullptr ? juce::Time::getHighResolutionTicks() : 0 }
+    {
+        if (counters != nullptr)
+            innermostLayoutTimer = this;
+    }
+
+    PerformanceCounters::ScopedLayoutTimer::~ScopedLayoutTimer()
+    {
+        if (counters == nullptr)
+            return;
+
+        const auto elapsedTicks = juce::Time::getHighResolutionTicks() - startTicks;
+
+        counters->layouts++;
+        counters->layoutTicks += elapsedTicks - nestedTicks;
+
+        if (enclosingTimer != nullptr)
+            enclosingTimer->nestedTicks += elapsedTicks;
+
+        innermostLayoutTimer = enclosingTimer;
+    }
+
+    void PerformanceCounters::setEnabled(bool shouldBeEnabled) noexcept
+    {
+        performanceCountersEnabled.store(shouldBeEnabled, std::memory_order_relaxed);
+    }
+
+    bool PerformanceCounters::isEnabled() noexcept
+    {
+        return performanceCountersEnabled.load(std::memory_order_relaxed);
+    }
+
+    void PerformanceCounters::countIdealSizeCalculation() noexcept
+    {
+        if (isEnabled())
+            idealSizeCalculations++;
+    }
+
+    void PerformanceCounters::countStyleApplication() noexcept
+    {
+        if (isEnabled())
+            styleApplications++;
+    }
+
+    void PerformanceCounters::countPaint() noexcept
+    {
+        if (isEnabled())
+            paints++;
+    }
+
+    void PerformanceCounters::countTransitionTick() noexcept
+    {
+        if (isEnabled())
+            transitionTicks++;
+    }
+
+    double PerformanceCounters::getLayoutMilliseconds() const
+    {
+        return juce::Time::highResolutionTicksToSeconds(layoutTicks) * 1000.0;
+    }
+
+    juce::var PerformanceCounters::toVar() const
+    {
+        auto object = std::make_unique<juce::DynamicObject>();
+        object->setProperty("layouts", static_cast<int>(layouts));
+        object->setProperty("layout-ms", getLayoutMilliseconds());
+        object->setProperty("ideal-size-calculations", static_cast<int>(idealSizeCalculations));
+        object->setProperty("style-applications", static_cast<int>(styleApplications));
+        object->setProperty("paints", static_cast<int>(paints));
+        object->setProperty("transition-ticks", static_cast<int>(transitionTicks));
+
+        return object.release();
+    }
+
+    void PerformanceCounters::reset() noexcept
+    {
+        *this = PerformanceCounters{};
+    }
+
+    PerformanceCounters& PerformanceCounters::operator+=(const PerformanceCounters& other) noexcept
+    {
+        layouts += other.layouts;
+        layoutTicks += other.layoutTicks;
+        idealSizeCalculations += other.idealSizeCalculations;
+        styleApplications += other.styleApplications;
+        paints += other.paints;
+        transitionTicks += other.transitionTicks;
+
+        return *this;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class PerformanceCountersTest : public juce::UnitTest
+{
+public:
+    PerformanceCountersTest()
+        : juce::UnitTest{ "jive::PerformanceCounters", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testDisabledByDefault();
+        testCounting();
+        testNestedLayoutTimers();
+    }
+
+private:
+    void testDisabledByDefault()
+    {
+        beginTest("disabled by default");
+
+        jive::PerformanceCounters counters;
+        expect(!jive::PerformanceCounters::isEnabled());
+
+        counters.countPaint();
+        {
+            const jive::PerformanceCounters::ScopedLayoutTimer timer{ counters };
+        }
+
+        expectEquals(counters.paints, juce::uint32{ 0 });
+        expectEquals(counters.layouts, juce::uint32{ 0 });
+    }
+
+    void testCounting()
+    {
+        beginTest("counting");
+
+        jive::PerformanceCounters::setEnabled(true);
+
+        jive::PerformanceCounters counters;
+        counters.countPaint();
+        counters.countStyleApplication();
+        counters.countStyleApplication();
+        {
+            const jive::PerformanceCounters::ScopedLayoutTimer timer{ counters };
+        }
+
+        expectEquals(counters.paints, juce::uint32{ 1 });
+        expectEquals(counters.styleApplications, juce::uint32{ 2 });
+        expectEquals(counters.layouts, juce::uint32{ 1 });
+        expect(counters.layoutTicks >= 0);
+
+        auto total = counters;
+        total += counters;
+        expectEquals(total.styleApplications, juce::uint32{ 4 });
+        expectEquals(static_cast<int>(total.toVar()["style-applications"]), 4);
+
+        total.reset();
+        expectEquals(total.styleApplications, juce::uint32{ 0 });
+
+        jive::PerformanceCounters::setEnabled(false);
+    }
+
+    void testNestedLayoutTimers()
+    {
+        beginTest("nested layout timers");
+
+        jive::PerformanceCounters::setEnabled(true);
+
+        jive::PerformanceCounters outer;
+        jive::PerformanceCounters inner;
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        {
+            const jive::PerformanceCounters::ScopedLayoutTimer outerTimer{ outer };
+            juce::Thread::sleep(5);
+
+            {
+                const jive::PerformanceCounters::ScopedLayoutTimer innerTimer{ inner };
+                juce::Thread::sleep(20);
+            }
+        }
+        const auto elapsedTicks = juce::Time::getHighResolutionTicks() - startTicks;
+
+        expectEquals(outer.layouts, juce::uint32{ 1 });
+        expectEquals(inner.layouts, juce::uint32{ 1 });
+        expect(outer.layoutTicks < inner.layoutTicks);
+        expect(outer.layoutTicks + inner.layoutTicks <= elapsedTicks);
+
+        jive::PerformanceCounters::setEnabled(false);
+    }
+};
+
+static PerformanceCountersTest performanceCountersTest;
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace jive
+{
+    /** Running totals of the work done on behalf of a single item: how often
+        it was laid out and for how long, how often its ideal size was
+        recalculated, its styles applied, its background painted, and its
+        transitions ticked.
+
+        Counting is switched off by default and can be switched on at runtime
+        with setEnabled(), so that expensive subtrees can be found in a
+        release build without attaching a profiler.
+    */
+    struct PerformanceCounters
+    {
+        /** Counts a layout and adds its duration to layoutTicks.
+
+            Timers can be nested, e.g. when laying out an item lays out its
+            children. The time spent in nested timers is only added to their
+            own counters, so summing layoutTicks over a subtree never counts
+            the same time twice.
+        */
+        class ScopedLayoutTimer
+        {
+        public:
+            explicit ScopedLayoutTimer(PerformanceCounters& countersToUpdate);
+            ~ScopedLayoutTimer();
+
+        private:
+            PerformanceCounters* const counters;
+            ScopedLayoutTimer* const enclosingTimer;
+            const juce::int64 startTicks;
+            juce::int64 nestedTicks{ 0 };
+
+            JUCE_DECLARE_NON_COPYABLE(ScopedLayoutTimer)
+        };
+
+        static void setEnabled(bool shouldBeEnabled) noexcept;
+        [[nodiscard]] static bool isEnabled() noexcept;
+
+        void countIdealSizeCalculation() noexcept;
+        void countStyleApplication() noexcept;
+        void countPaint() noexcept;
+        void countTransitionTick() noexcept;
+
+        [[nodiscard]] double getLayoutMilliseconds() const;
+        [[nodiscard]] juce::var toVar() const;
+        void reset() noexcept;
+
+        PerformanceCounters& operator+=(const PerformanceCounters& other) noexcept;
+
+        juce::uint32 layouts{ 0 };
+        juce::int64 layoutTicks{ 0 };
+        juce::uint32 idealSizeCalculations{ 0 };
+        juce::uint32 styleApplications{ 0 };
+        juce::uint32 paints{ 0 };
+        juce::uint32 transitionTicks{ 0 };
+    };
+} // namespace jive
@@ -0,0 +1,271 @@
+#include "jive_Profiler.h"
+
+namespace jive
+{
+    class Profiler::ThreadBuffer
+    {
+    public:
+        explicit ThreadBuffer(int index)
+            : threadIndex{ index }
+            , events(static_cast<std::size_t>(eventsPerThread))
+        {
+        }
+
+        void add(Event&& event)
+        {
+            const juce::SpinLock::ScopedLockType lock{ mutex };
+
+            events[nextIndex] = std::move(event);
+            nextIndex = (nextIndex + 1) % std::size(events);
+            numEvents = juce::jmin(numEvents + 1, std::size(events));
+        }
+
+        void clear()
+        {
+            const juce::SpinLock::ScopedLockType lock{ mutex };
+
+            nextIndex = 0;
+            numEvents = 0;
+        }
+
+        [[nodiscard]] int getNumEvents() const
+        {
+            const juce::SpinLock::ScopedLockType lock{ mutex };
+            return static_cast<int>(numEvents);
+        }
+
+        template <typename Callback>
+        void forEachEvent(Callback&& callback) const
+        {
+            const juce::SpinLock::ScopedLockType lock{ mutex };
+            const auto first = (nextIndex + std::size(events) - numEvents) % std::size(events);
+
+            for (std::size_t i = 0; i < numEvents; i++)
+                callback(events[(first + i) % std::size(events)]);
+        }
+
+        const int threadIndex;
+
+    private:
+        mutable juce::SpinLock mutex;
+        std::vector<Event> events;
+        std::size_t nextIndex{ 0 };
+        std::size_t numEvents{ 0 };
+    };
+
+    Profiler::Scope::Scope(const char* name)
+        : recording{ Profiler::getInstance().isRecording() }
+    {
+        if (recording)
+        {
+            event.name = name;
+            event.beginTicks = juce::Time::getHighResolutionTicks();
+        }
+    }
+
+    Profiler::Scope::Scope(const char* name, const juce::ValueTree& tree)
+        : recording{ Profiler::getInstance().isRecording() }
+    {
+        if (recording)
+        {
+            event.name = name;
+            event.itemID = tree["id"].toString();
+            event.itemType = tree.getType();
+            event.beginTicks = juce::Time::getHighResolutionTicks();
+        }
+    }
+
+    Profiler::Scope::~Scope()
+    {
+        if (recording)
+        {
+            event.endTicks = juce::Time::getHighResolutionTicks();
+            Profiler::getInstance().record(std::move(event));
+        }
+    }
+
+    Profiler& Profiler::getInstance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    Profiler::~Profiler() = default;
+
+    void Profiler::startRecording()
+    {
+        recording.store(true);
+    }
+
+    void Profiler::stopRecording()
+    {
+        recording.store(false);
+    }
+
+    bool Profiler::isRecording() const noexcept
+    {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::clear()
+    {
+        const std::lock_guard lock{ buffersMutex };
+
+        for (auto& buffer : buffers)
+            buffer->clear();
+    }
+
+    int Profiler::getNumEvents() const
+    {
+        const std::lock_guard lock{ buffersMutex };
+
+        return std::accumulate(std::begin(buffers),
+                               std::end(buffers),
+                               0,
+                               [](auto total, const auto& buffer) {
+                                   return total + buffer->getNumEvents();
+                               });
+    }
+
+    Profiler::ThreadBuffer& Profiler::getBufferForThisThread()
+    {
+        thread_local ThreadBuffer* buffer = nullptr;
+
+        if (buffer == nullptr)
+        {
+            const std::lock_guard lock{ buffersMutex };
+
+            buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<int>(std::size(buffers)) + 1));
+            buffer = buffers.back().get();
+        }
+
+        return *buffer;
+    }
+
+    void Profiler::record(Event&& event)
+    {
+        getBufferForThisThread().add(std::move(event));
+    }
+
+    [[nodiscard]] static double ticksToMicroseconds(juce::int64 ticks)
+    {
+        return juce::Time::highResolutionTicksToSeconds(ticks) * 1.0e6;
+    }
+
+    juce::String Profiler::exportChromeTrace() const
+    {
+        juce::Array<juce::var> traceEvents;
+
+        const std::lock_guard lock{ buffersMutex };
+
+        for (const auto& buffer : buffers)
+        {
+            buffer->forEachEvent([&traceEvents, tid = buffer->threadIndex](const Event& event) {
+                auto arguments = std::make_unique<juce::DynamicObject>();
+
+                if (event.itemID.isNotEmpty())
+                    arguments->setProperty("id", event.itemID);
+                if (event.itemType.isValid())
+                    arguments->setProperty("type", event.itemType.toString());
+
+                const auto name = event.itemType.isValid()
+                                    ? juce::String{ event.name } + " (" + event.itemType.toString() + (event.itemID.isNotEmpty() ? "#" + event.itemID : juce::String{}) + ")"
+                                    : juce::String{ event.name };
+
+                auto traceEvent = std::make_unique<juce::DynamicObject>();
+                traceEvent->setProperty("name", name);
+                traceEvent->setProperty("cat", "jive");
+                traceEvent->setProperty("ph", "X");
+                traceEvent->setProperty("ts", ticksToMicroseconds(event.beginTicks));
+                traceEvent->setProperty("dur", ticksToMicroseconds(event.endTicks - event.beginTicks));
+                traceEvent->setProperty("pid", 1);
+                traceEvent->setProperty("tid", tid);
+                traceEvent->setProperty("args", arguments.release());
+
+                traceEvents.add(traceEvent.release());
+            });
+        }
+
+        auto trace = std::make_unique<juce::DynamicObject>();
+        trace->setProperty("traceEvents", traceEvents);
+        trace->setProperty("displayTimeUnit", "ms");
+
+        return juce::JSON::toString(juce::var{ trace.release() }, true);
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class ProfilerTest : public juce::UnitTest
+{
+public:
+    ProfilerTest()
+        : juce::UnitTest{ "jive::Profiler", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testRecording();
+        testChromeTraceExport();
+    }
+
+private:
+    void testRecording()
+    {
+        beginTest("recording");
+
+        auto& profiler = jive::Profiler::getInstance();
+        profiler.clear();
+
+        {
+            const jive::Profiler::Scope scope{ "not recorded" };
+        }
+
+        expectEquals(profiler.getNumEvents(), 0);
+
+        profiler.startRecording();
+
+        {
+            const jive::Profiler::Scope outer{ "outer" };
+            const jive::Profiler::Scope inner{ "inner", juce::ValueTree{ "Component", { { "id", "item" } } } };
+        }
+
+        profiler.stopRecording();
+        expectEquals(profiler.getNumEvents(), 2);
+
+        profiler.clear();
+        expectEquals(profiler.getNumEvents(), 0);
+    }
+
+    void testChromeTraceExport()
+    {
+        beginTest("Chrome trace export");
+
+        auto& profiler = jive::Profiler::getInstance();
+        profiler.clear();
+        profiler.startRecording();
+
+        {
+            const jive::Profiler::Scope scope{ "layOutChildren", juce::ValueTree{ "Component", { { "id", "root" } } } };
+        }
+
+        profiler.stopRecording();
+
+        const auto trace = juce::JSON::parse(profiler.exportChromeTrace());
+        const auto* events = trace["traceEvents"].getArray();
+        expect(events != nullptr);
+        expectEquals(events->size(), 1);
+
+        const auto& event = events->getReference(0);
+        expectEquals(event["name"].toString(), juce::String{ "layOutChildren (Component#root)" });
+        expectEquals(event["ph"].toString(), juce::String{ "X" });
+        expectEquals(event["args"]["id"].toString(), juce::String{ "root" });
+        expectEquals(event["args"]["type"].toString(), juce::String{ "Component" });
+        expect(static_cast<double>(event["dur"]) >= 0.0);
+
+        profiler.clear();
+    }
+};
+
+static ProfilerTest profilerTest;
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <juce_data_structures/juce_data_structures.h>
+
+#ifndef JIVE_PROFILING
+    #define JIVE_PROFILING 0
+#endif
+
+#if JIVE_PROFILING
+    #define JIVE_PROFILE_SCOPE(name) \
+        const jive::Profiler::Scope JUCE_JOIN_MACRO(jiveProfilingScope, __LINE__) { name }
+    #define JIVE_PROFILE_TREE_SCOPE(name, tree) \
+        const jive::Profiler::Scope JUCE_JOIN_MACRO(jiveProfilingScope, __LINE__) { name, tree }
+#else
+    #define JIVE_PROFILE_SCOPE(name)
+    #define JIVE_PROFILE_TREE_SCOPE(name, tree)
+#endif
+
+namespace jive
+{
+    /** Records how long JIVE spends in each phase of a view's lifetime -
+        interpreting, styling, laying out and painting - so that the cost can
+        be attributed to specific items.
+
+        Scopes are declared with JIVE_PROFILE_SCOPE and JIVE_PROFILE_TREE_SCOPE,
+        which compile to nothing unless JIVE_PROFILING is enabled. Even then,
+        nothing is recorded until startRecording() is called. Each thread
+        writes its events into its own fixed-size ring buffer, so recording
+        never allocates and the oldest events are overwritten once a buffer is
+        full.
+
+        The recorded events can be exported in Chrome's trace-event format and
+        opened in chrome://tracing or https://ui.perfetto.dev.
+    */
+    class Profiler
+    {
+    public:
+        struct Event
+        {
+            const char* name{ nullptr };
+            juce::String itemID;
+            juce::Identifier itemType;
+            juce::int64 beginTicks{ 0 };
+            juce::int64 endTicks{ 0 };
+        };
+
+        class Scope
+        {
+        public:
+            explicit Scope(const char* name);
+            Scope(const char* name, const juce::ValueTree& tree);
+            ~Scope();
+
+        private:
+            Event event;
+            const bool recording;
+
+            JUCE_DECLARE_NON_COPYABLE(Scope)
+        };
+
+        [[nodiscard]] static Profiler& getInstance();
+
+        void startRecording();
+        void stopRecording();
+        [[nodiscard]] bool isRecording() const noexcept;
+
+        void clear();
+        [[nodiscard]] int getNumEvents() const;
+
+        [[nodiscard]] juce::String exportChromeTrace() const;
+
+        static constexpr int eventsPerThread = 1 << 16;
+
+    private:
+        class ThreadBuffer;
+
+        Profiler() = default;
+        ~Profiler();
+
+        [[nodiscard]] ThreadBuffer& getBufferForThisThread();
+        void record(Event&& event);
+
+        std::atomic<bool> recording{ false };
+        mutable std::mutex buffersMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+        JUCE_DECLARE_NON_COPYABLE(Profiler)
+    };
+} // namespace jive
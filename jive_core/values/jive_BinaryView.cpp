@@ -0,0 +1,536 @@
+#include "jive_BinaryView.h"
+
+namespace jive
+{
+    static constexpr std::array<char, 4> binaryViewMagic{ 'J', 'I', 'V', 'B' };
+    static constexpr juce::uint8 binaryViewVersion = 1;
+    static constexpr auto binaryViewHeaderSize = std::size(binaryViewMagic) + 1;
+
+    // Deeper views are treated as malformed, rather than risking running out
+    // of stack while loading them
+    static constexpr auto maxBinaryViewDepth = 256;
+
+    // A child's size, type, number of properties, and number of children
+    static constexpr auto minBinaryChildSize = 4;
+
+    enum class BinaryValueType : juce::uint8
+    {
+        none,
+        string,
+        integer,
+        integer64,
+        decimal,
+        boolean,
+        json,
+    };
+
+    class BinaryViewWriter
+    {
+    public:
+        [[nodiscard]] juce::MemoryBlock write(const juce::ValueTree& view)
+        {
+            juce::MemoryOutputStream body;
+            writeTree(body, view);
+
+            juce::MemoryOutputStream stream;
+            stream.write(binaryViewMagic.data(), std::size(binaryViewMagic));
+            stream.writeByte(static_cast<char>(binaryViewVersion));
+            writeTable(stream, identifiers);
+            writeTable(stream, strings);
+            stream << body.getMemoryBlock();
+
+            return stream.getMemoryBlock();
+        }
+
+    private:
+        struct Table
+        {
+            juce::StringArray entries;
+            std::map<juce::String, int> indices;
+        };
+
+        [[nodiscard]] static int intern(Table& table, const juce::String& entry)
+        {
+            if (const auto existing = table.indices.find(entry);
+                existing != std::end(table.indices))
+            {
+                return existing->second;
+            }
+
+            const auto index = table.entries.size();
+            table.entries.add(entry);
+            table.indices.emplace(entry, index);
+
+            return index;
+        }
+
+        static void writeTable(juce::OutputStream& stream, const Table& table)
+        {
+            stream.writeCompressedInt(table.entries.size());
+
+            for (const auto& entry : table.entries)
+                stream.writeString(entry);
+        }
+
+        void writeTree(juce::OutputStream& stream, const juce::ValueTree& tree)
+        {
+            stream.writeCompressedInt(intern(identifiers, tree.getType().toString()));
+            stream.writeCompressedInt(tree.getNumProperties());
+
+            for (auto i = 0; i < tree.getNumProperties(); i++)
+            {
+                const auto name = tree.getPropertyName(i);
+                stream.writeCompressedInt(intern(identifiers, name.toString()));
+                writeValue(stream, tree[name]);
+            }
+
+            stream.writeCompressedInt(tree.getNumChildren());
+
+            for (const auto& child : tree)
+            {
+                // Sizing each child lets a reader skip it, and lets the
+                // loader check it read the child correctly
+                juce::MemoryOutputStream childStream;
+                writeTree(childStream, child);
+
+                stream.writeCompressedInt(static_cast<int>(childStream.getDataSize()));
+                stream << childStream.getMemoryBlock();
+            }
+        }
+
+        void writeValue(juce::OutputStream& stream, const juce::var& value)
+        {
+            const auto writeType = [&stream](BinaryValueType type) {
+                stream.writeByte(static_cast<char>(type));
+            };
+
+            if (value.isVoid() || value.isUndefined())
+            {
+                writeType(BinaryValueType::none);
+            }
+            else if (value.isBool())
+            {
+                writeType(BinaryValueType::boolean);
+                stream.writeBool(value);
+            }
+            else if (value.isInt())
+            {
+                writeType(BinaryValueType::integer);
+                stream.writeCompressedInt(value);
+            }
+            else if (value.isInt64())
+            {
+                writeType(BinaryValueType::integer64);
+                stream.writeInt64(value);
+            }
+            else if (value.isDouble())
+            {
+                writeType(BinaryValueType::decimal);
+                stream.writeDouble(value);
+            }
+            else if (value.isObject() || value.isArray())
+            {
+                writeType(BinaryValueType::json);
+                stream.writeCompressedInt(intern(strings, juce::JSON::toString(value, true)));
+            }
+            else
+            {
+                // Strings are kept as strings, even if they look like
+                // numbers, as some converters treat "2" and 2 differently
+                writeType(BinaryValueType::string);
+                stream.writeCompressedInt(intern(strings, value.toString()));
+            }
+        }
+
+        Table identifiers;
+        Table strings;
+    };
+
+    class BinaryViewReader
+    {
+    public:
+        BinaryViewReader(const void* data, std::size_t dataSize)
+            : stream{ data, dataSize, false }
+        {
+        }
+
+        [[nodiscard]] juce::ValueTree read()
+        {
+            stream.setPosition(static_cast<juce::int64>(binaryViewHeaderSize));
+
+            readIdentifiers();
+            readStrings();
+
+            if (failed)
+                return {};
+
+            auto view = readTree(0);
+
+            if (failed || !stream.isExhausted())
+                return {};
+
+            return view;
+        }
+
+    private:
+        [[nodiscard]] bool canRead(juce::int64 numBytes)
+        {
+            if (stream.getNumBytesRemaining() < numBytes)
+                failed = true;
+
+            return !failed;
+        }
+
+        [[nodiscard]] int readCompressedInt()
+        {
+            if (!canRead(1))
+                return 0;
+
+            const auto* bytes = static_cast<const juce::uint8*>(stream.getData());
+            const auto numBytes = bytes[stream.getPosition()] & 0x7f;
+
+            if (numBytes > 4 || !canRead(1 + numBytes))
+            {
+                failed = true;
+                return 0;
+            }
+
+            return stream.readCompressedInt();
+        }
+
+        [[nodiscard]] int readCount(int minBytesEach = 1)
+        {
+            const auto count = readCompressedInt();
+
+            if (count < 0 || static_cast<juce::int64>(count) * minBytesEach > stream.getNumBytesRemaining())
+                failed = true;
+
+            return failed ? 0 : count;
+        }
+
+        [[nodiscard]] int readIndex(std::size_t tableSize)
+        {
+            const auto index = readCompressedInt();
+
+            if (index < 0 || static_cast<std::size_t>(index) >= tableSize)
+                failed = true;
+
+            return failed ? 0 : index;
+        }
+
+        void readIdentifiers()
+        {
+            const auto numIdentifiers = readCount();
+            identifiers.reserve(static_cast<std::size_t>(numIdentifiers));
+
+            for (auto i = 0; i < numIdentifiers && !failed; i++)
+            {
+                const auto name = stream.readString();
+
+                if (name.isEmpty())
+                    failed = true;
+                else
+                    identifiers.emplace_back(name);
+            }
+        }
+
+        void readStrings()
+        {
+            const auto numStrings = readCount();
+            strings.reserve(static_cast<std::size_t>(numStrings));
+
+            for (auto i = 0; i < numStrings && !failed; i++)
+                strings.emplace_back(stream.readString());
+        }
+
+        [[nodiscard]] juce::ValueTree readTree(int depth)
+        {
+            if (depth > maxBinaryViewDepth)
+            {
+                failed = true;
+                return {};
+            }
+
+            const auto typeIndex = readIndex(std::size(identifiers));
+
+            if (failed)
+                return {};
+
+            juce::ValueTree tree{ identifiers[static_cast<std::size_t>(typeIndex)] };
+            const auto numProperties = readCount();
+
+            for (auto i = 0; i < numProperties && !failed; i++)
+            {
+                const auto nameIndex = readIndex(std::size(identifiers));
+                auto value = readValue();
+
+                if (!failed)
+                    tree.setProperty(identifiers[static_cast<std::size_t>(nameIndex)], std::move(value), nullptr);
+            }
+
+            const auto numChildren = readCount(minBinaryChildSize);
+
+            for (auto i = 0; i < numChildren && !failed; i++)
+            {
+                const auto childSize = readCount();
+                const auto childEnd = stream.getPosition() + childSize;
+                auto child = readTree(depth + 1);
+
+                if (failed || stream.getPosition() != childEnd)
+                {
+                    failed = true;
+                    return {};
+                }
+
+                tree.appendChild(child, nullptr);
+            }
+
+            return failed ? juce::ValueTree{} : tree;
+        }
+
+        [[nodiscard]] juce::var readValue()
+        {
+            if (!canRead(1))
+                return {};
+
+            switch (static_cast<BinaryValueType>(stream.readByte()))
+            {
+            case BinaryValueType::none:
+                return {};
+            case BinaryValueType::string:
+            {
+                const auto index = readIndex(std::size(strings));
+                return failed ? juce::var{} : strings[static_cast<std::size_t>(index)];
+            }
+            case BinaryValueType::integer:
+                return readCompressedInt();
+            case BinaryValueType::integer64:
+                return canRead(8) ? juce::var{ stream.readInt64() } : juce::var{};
+            case BinaryValueType::decimal:
+                return canRead(8) ? juce::var{ stream.readDouble() } : juce::var{};
+            case BinaryValueType::boolean:
+                return canRead(1) ? juce::var{ stream.readBool() } : juce::var{};
+            case BinaryValueType::json:
+            {
+                const auto index = readIndex(std::size(strings));
+                return failed ? juce::var{} : parseJSON(strings[static_cast<std::size_t>(index)]);
+            }
+            }
+
+            failed = true;
+            return {};
+        }
+
+        juce::MemoryInputStream stream;
+        std::vector<juce::Identifier> identifiers;
+        std::vector<juce::var> strings;
+        bool failed{ false };
+    };
+
+    juce::MemoryBlock compileBinaryView(const juce::ValueTree& view)
+    {
+        jassert(view.isValid());
+
+        BinaryViewWriter writer;
+        return writer.write(view);
+    }
+
+    bool isBinaryView(const void* data, std::size_t dataSize)
+    {
+        if (data == nullptr || dataSize < binaryViewHeaderSize)
+            return false;
+
+        const auto* bytes = static_cast<const char*>(data);
+
+        return std::equal(std::begin(binaryViewMagic), std::end(binaryViewMagic), bytes)
+            && static_cast<juce::uint8>(bytes[std::size(binaryViewMagic)]) == binaryViewVersion;
+    }
+
+    juce::ValueTree loadBinaryView(const void* data, std::size_t dataSize)
+    {
+        if (!isBinaryView(data, dataSize))
+            return {};
+
+        BinaryViewReader reader{ data, dataSize };
+        return reader.read();
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+    #include "jive_XmlParser.h"
+
+class BinaryViewUnitTest : public juce::UnitTest
+{
+public:
+    BinaryViewUnitTest()
+        : juce::UnitTest{ "jive::BinaryView", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testRoundTrip();
+        testTypedValues();
+        testInterning();
+        testMalformedData();
+        testDeepViews();
+        testChildCounts();
+        testParsingXML();
+    }
+
+private:
+    void testRoundTrip()
+    {
+        beginTest("round trip");
+
+        const auto view = jive::parseXML(R"(
+            <Window width="640" height="400" align-items="centre">
+                <Button id="ok" flex-grow="1.5">
+                    <Text>Press me</Text>
+                </Button>
+                <Component style="{ 'background': '#FF0000' }"/>
+                <Button id="cancel" flex-grow="1"/>
+            </Window>
+        )");
+        const auto binary = jive::compileBinaryView(view);
+        expect(jive::isBinaryView(binary.getData(), binary.getSize()));
+
+        const auto loaded = jive::loadBinaryView(binary.getData(), binary.getSize());
+        expect(loaded.isValid());
+        expect(loaded.isEquivalentTo(view));
+        expectEquals(loaded.getChild(0).getChild(0)["text"].toString(), juce::String{ "Press me" });
+    }
+
+    void testTypedValues()
+    {
+        beginTest("typed values");
+
+        juce::ValueTree view{
+            "Component",
+            {
+                { "width", "100" },
+                { "flex-grow", "1.5" },
+                { "padding", "010" },
+                { "margin", "1.50" },
+                { "height", "auto" },
+                { "count", 3 },
+                { "ratio", 0.5 },
+                { "toggled", true },
+                { "time", juce::int64{ 1234567890123 } },
+            },
+        };
+        view.setProperty("style", new jive::Object{ { "foreground", "#00FF00" } }, nullptr);
+
+        const auto binary = jive::compileBinaryView(view);
+        const auto loaded = jive::loadBinaryView(binary.getData(), binary.getSize());
+
+        expect(loaded["width"].isString());
+        expectEquals(loaded["width"].toString(), juce::String{ "100" });
+        expect(loaded["flex-grow"].isString());
+        expectEquals(loaded["flex-grow"].toString(), juce::String{ "1.5" });
+        expect(loaded["padding"].isString());
+        expectEquals(loaded["padding"].toString(), juce::String{ "010" });
+        expect(loaded["margin"].isString());
+        expect(loaded["height"].isString());
+        expect(loaded["count"].isInt());
+        expect(loaded["ratio"].isDouble());
+        expect(loaded["toggled"].isBool());
+        expect(loaded["time"].isInt64());
+
+        auto* style = dynamic_cast<jive::Object*>(loaded["style"].getDynamicObject());
+        expect(style != nullptr);
+        expectEquals((*style)["foreground"].toString(), juce::String{ "#00FF00" });
+    }
+
+    void testInterning()
+    {
+        beginTest("interning");
+
+        juce::ValueTree view{ "Component" };
+
+        for (auto i = 0; i < 100; i++)
+        {
+            view.appendChild(juce::ValueTree{
+                                 "Button",
+                                 { { "justify-content", "space-between" } },
+                             },
+                             nullptr);
+        }
+
+        const auto binary = jive::compileBinaryView(view);
+        expect(binary.getSize() < view.toXmlString().getNumBytesAsUTF8() / 4);
+
+        const auto loaded = jive::loadBinaryView(binary.getData(), binary.getSize());
+        expect(loaded.isEquivalentTo(view));
+    }
+
+    void testMalformedData()
+    {
+        beginTest("malformed data");
+
+        expect(!jive::loadBinaryView(nullptr, 0).isValid());
+
+        const juce::String xml{ "<Component/>" };
+        expect(!jive::isBinaryView(xml.toRawUTF8(), xml.getNumBytesAsUTF8()));
+        expect(!jive::loadBinaryView(xml.toRawUTF8(), xml.getNumBytesAsUTF8()).isValid());
+
+        const auto view = jive::parseXML("<Component width=\"10\"><Button/><Button/></Component>");
+        const auto binary = jive::compileBinaryView(view);
+
+        for (std::size_t size = 0; size < binary.getSize(); size++)
+            expect(!jive::loadBinaryView(binary.getData(), size).isValid());
+
+        auto corrupted = binary;
+        corrupted[static_cast<int>(binary.getSize() - 1)] = static_cast<char>(0x7f);
+        expect(!jive::loadBinaryView(corrupted.getData(), corrupted.getSize()).isEquivalentTo(view));
+    }
+
+    void testDeepViews()
+    {
+        beginTest("deep views");
+
+        const auto createView = [](int depth) {
+            juce::ValueTree view{ "Component" };
+
+            for (auto i = 0; i < depth; i++)
+                view = juce::ValueTree{ "Component", {}, { view } };
+
+            return view;
+        };
+
+        const auto shallow = jive::compileBinaryView(createView(100));
+        expect(jive::loadBinaryView(shallow.getData(), shallow.getSize()).isValid());
+
+        const auto deep = jive::compileBinaryView(createView(1000));
+        expect(!jive::loadBinaryView(deep.getData(), deep.getSize()).isValid());
+    }
+
+    void testChildCounts()
+    {
+        beginTest("child counts");
+
+        const auto view = jive::parseXML("<Component><Button/></Component>");
+        auto binary = jive::compileBinaryView(view);
+
+        // The root's child count is the byte before the first child's size,
+        // type, and empty property and child counts
+        const auto childCountIndex = static_cast<int>(binary.getSize()) - 5;
+        expectEquals(static_cast<int>(binary[childCountIndex]), 1);
+
+        binary[childCountIndex] = static_cast<char>(2);
+        expect(!jive::loadBinaryView(binary.getData(), binary.getSize()).isValid());
+    }
+
+    void testParsingXML()
+    {
+        beginTest("parsing XML");
+
+        const auto view = jive::parseXML("<Component><Text>Hello</Text></Component>");
+        const auto binary = jive::compileBinaryView(view);
+        const auto loaded = jive::parseXML(binary.getData(), static_cast<int>(binary.getSize()));
+        expect(loaded.isEquivalentTo(view));
+    }
+};
+
+static BinaryViewUnitTest binaryViewUnitTest;
+#endif
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace jive
+{
+    /** Compiles a view into a compact binary form that can be loaded without
+        parsing any XML.
+
+        Tree types and property names are interned in a table of identifiers,
+        and property values in a table of strings, so each is only stored,
+        and only created when loading, once. Values keep their types, so
+        attributes parsed from XML are loaded as strings exactly as they were
+        written. Every child is preceded by its size, so a reader can skip
+        whole subtrees.
+
+        Pass the result of parseXML() to have inline text handled in the same
+        way as when interpreting XML.
+    */
+    [[nodiscard]] juce::MemoryBlock compileBinaryView(const juce::ValueTree& view);
+
+    /** Returns true if the given data starts with the header written by
+        compileBinaryView().
+    */
+    [[nodiscard]] bool isBinaryView(const void* data, std::size_t dataSize);
+
+    /** Builds the ValueTree for a view compiled with compileBinaryView(), in a
+        single pass over the data. The data isn't copied, so it can be loaded
+        straight from BinaryData or a memory-mapped file.
+
+        Returns an invalid tree if the data is malformed.
+    */
+    [[nodiscard]] juce::ValueTree loadBinaryView(const void* data, std::size_t dataSize);
+} // namespace jive
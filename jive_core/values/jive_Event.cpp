@@ -1,5 +1,264 @@
 #include "jive_Event.h"
 
+namespace jive
+{
+    EventChannel::Subscription EventChannel::subscribe(Event& event)
+    {
+        const auto generation = ++latestGeneration;
+
+        for (std::size_t i = 0; i < std::size(subscribers); i++)
+        {
+            if (subscribers[i].event == nullptr)
+            {
+                subscribers[i] = { &event, generation };
+                return { i, generation };
+            }
+        }
+
+        subscribers.push_back({ &event, generation });
+        return { std::size(subscribers) - 1, generation };
+    }
+
+    void EventChannel::unsubscribe(const Subscription& subscription)
+    {
+        if (subscription.index >= std::size(subscribers))
+            return;
+
+        if (subscribers[subscription.index].generation != subscription.generation)
+            return;
+
+        subscribers[subscription.index].event = nullptr;
+
+        while (!subscribers.empty() && subscribers.back().event == nullptr)
+            subscribers.pop_back();
+    }
+
+    void EventChannel::trigger()
+    {
+        // A callback may release the last reference to this channel
+        const ReferenceCountedPointer keepAlive{ this };
+
+        triggerCount++;
+        timeLastTriggered = juce::Time::currentTimeMillis();
+
+        // Events subscribed by the callbacks aren't called until the next
+        // trigger
+        const auto generationAtTrigger = latestGeneration;
+
+        for (std::size_t i = 0; i < std::size(subscribers); i++)
+        {
+            const auto subscriber = subscribers[i];
+
+            if (subscriber.event == nullptr || subscriber.generation > generationAtTrigger)
+                continue;
+
+            if (subscriber.event->onTrigger != nullptr)
+                subscriber.event->onTrigger();
+        }
+    }
+
+    int EventChannel::getTriggerCount() const noexcept
+    {
+        return triggerCount;
+    }
+
+    juce::Time EventChannel::getTimeLastTriggered() const noexcept
+    {
+        return juce::Time{ timeLastTriggered };
+    }
+
+    int EventChannel::getNumSubscribers() const noexcept
+    {
+        return static_cast<int>(std::count_if(std::begin(subscribers),
+                                              std::end(subscribers),
+                                              [](const auto& subscriber) {
+                                                  return subscriber.event != nullptr;
+                                              }));
+    }
+
+    juce::var EventChannel::createCallbacksVar() const
+    {
+        juce::Array<juce::var> callbacks;
+
+        for (const auto& subscriber : subscribers)
+        {
+            if (subscriber.event == nullptr)
+                continue;
+
+            callbacks.add(juce::var{
+                [weakEvent = juce::WeakReference<Event>{ subscriber.event }](const juce::var::NativeFunctionArgs&) {
+                    if (weakEvent != nullptr && weakEvent->onTrigger != nullptr)
+                        weakEvent->onTrigger();
+
+                    return juce::var{};
+                },
+            });
+        }
+
+        return callbacks;
+    }
+
+    bool EventChannel::hasProperty(const juce::Identifier& propertyName) const
+    {
+        if (propertyName == callbacksID)
+            return true;
+
+        // A channel that's never been triggered has no count or time
+        if (propertyName == countID || propertyName == timeID)
+            return triggerCount > 0;
+
+        return Object::hasProperty(propertyName);
+    }
+
+    const juce::var& EventChannel::getProperty(const juce::Identifier& propertyName) const
+    {
+        if (propertyName == callbacksID)
+        {
+            callbacksVar = createCallbacksVar();
+            return callbacksVar;
+        }
+
+        if (propertyName == countID)
+        {
+            countVar = triggerCount > 0 ? juce::var{ triggerCount } : juce::var{};
+            return countVar;
+        }
+
+        if (propertyName == timeID)
+        {
+            timeVar = triggerCount > 0 ? juce::var{ timeLastTriggered } : juce::var{};
+            return timeVar;
+        }
+
+        return Object::getProperty(propertyName);
+    }
+
+    Event::Event(juce::ValueTree sourceState, const juce::Identifier& eventID)
+        : id{ eventID }
+        , state{ sourceState }
+    {
+        subscribeTo(getOrCreateChannel(state, id));
+        listenToState();
+    }
+
+    Event::Event(const Event& other)
+        : id{ other.id }
+        , state{ other.state }
+    {
+        subscribeTo(other.channel);
+        listenToState();
+    }
+
+    Event::Event(Event&& other)
+        : Event{ static_cast<const Event&>(other) }
+    {
+    }
+
+    Event& Event::operator=(const Event& other)
+    {
+        if (this == &other || channel == other.channel)
+            return *this;
+
+        // Every Event on the same property, this one included, moves to the
+        // new channel when it's told the property changed
+        state.setProperty(id, other.channel.get(), nullptr);
+
+        // ...unless the tree is invalid, or the change was deferred
+        if (channel != other.channel)
+            subscribeTo(other.channel);
+
+        return *this;
+    }
+
+    Event::~Event()
+    {
+        if (dispatcher != nullptr)
+            dispatcher->removeListener(id, *this);
+
+        subscribeTo(nullptr);
+    }
+
+    int Event::getAssumedTriggerCount() const
+    {
+        if (channel == nullptr)
+            return 0;
+
+        return channel->getTriggerCount();
+    }
+
+    juce::Time Event::getTimeLastTriggered() const
+    {
+        if (channel == nullptr)
+            return juce::Time{};
+
+        return channel->getTimeLastTriggered();
+    }
+
+    void Event::trigger()
+    {
+        // The channel may have been removed from the tree
+        if (channel == nullptr && state.isValid())
+            subscribeTo(getOrCreateChannel(state, id));
+
+        if (channel != nullptr)
+            channel->trigger();
+    }
+
+    void Event::triggerWithoutSelfCallback()
+    {
+        const auto callback = onTrigger;
+        onTrigger = nullptr;
+
+        juce::WeakReference weakThis{ this };
+        trigger();
+
+        if (weakThis != nullptr)
+            weakThis->onTrigger = callback;
+    }
+
+    EventChannel::ReferenceCountedPointer Event::getOrCreateChannel(juce::ValueTree& tree,
+                                                                    const juce::Identifier& eventID)
+    {
+        if (auto* existing = dynamic_cast<EventChannel*>(tree[eventID].getDynamicObject()))
+            return existing;
+
+        EventChannel::ReferenceCountedPointer newChannel = new EventChannel{};
+        tree.setProperty(eventID, newChannel.get(), nullptr);
+
+        return newChannel;
+    }
+
+    void Event::subscribeTo(EventChannel::ReferenceCountedPointer newChannel)
+    {
+        if (channel != nullptr)
+            channel->unsubscribe(subscription);
+
+        channel = std::move(newChannel);
+
+        if (channel != nullptr)
+            subscription = channel->subscribe(*this);
+    }
+
+    void Event::listenToState()
+    {
+        dispatcher = PropertyDispatcher::getFor(state);
+
+        if (dispatcher != nullptr)
+            dispatcher->addListener(id, *this);
+    }
+
+    void Event::valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& property)
+    {
+        if (tree != state || property != id)
+            return;
+
+        EventChannel::ReferenceCountedPointer newChannel = dynamic_cast<EventChannel*>(state[id].getDynamicObject());
+
+        if (newChannel != channel)
+            subscribeTo(std::move(newChannel));
+    }
+} // namespace jive
+
 #if JIVE_UNIT_TESTS
     #include <jive_core/logging/jive_StringStreams.h>
 
@@ -17,6 +276,11 @@ public:
         testObserving();
         testTiming();
         testCopying();
+        testAssigning();
+        testReplacingFromOutside();
+        testSubscriptions();
+        testCallbacksVar();
+        testScriptProperties();
     }
 
 private:
@@ -112,6 +376,180 @@ private:
         clonedEvent.trigger();
         expect(wasTriggered);
     }
+
+    void testAssigning()
+    {
+        beginTest("assigning");
+
+        juce::ValueTree state{ "State" };
+        jive::Event event{ state, "event" };
+        jive::Event sibling{ state, "event" };
+        jive::Event unrelated{ state, "other" };
+
+        juce::ValueTree otherState{ "State" };
+        jive::Event source{ otherState, "event" };
+        source.trigger();
+
+        auto siblingTriggers = 0;
+        sibling.onTrigger = [&siblingTriggers] {
+            siblingTriggers++;
+        };
+
+        event = source;
+        expectEquals(sibling.getAssumedTriggerCount(), 1);
+
+        source.trigger();
+        expectEquals(siblingTriggers, 1);
+        expectEquals(sibling.getAssumedTriggerCount(), 2);
+
+        sibling.trigger();
+        expectEquals(event.getAssumedTriggerCount(), 3);
+        expectEquals(unrelated.getAssumedTriggerCount(), 0);
+        expect(state["event"] == otherState["event"]);
+    }
+
+    void testReplacingFromOutside()
+    {
+        beginTest("replacing from outside");
+
+        juce::ValueTree state{ "State" };
+        jive::Event event{ state, "event" };
+        jive::Event sibling{ state, "event" };
+
+        auto numTriggers = 0;
+        event.onTrigger = [&numTriggers] {
+            numTriggers++;
+        };
+        sibling.onTrigger = [&numTriggers] {
+            numTriggers++;
+        };
+
+        juce::ValueTree otherState{ "State" };
+        jive::Event source{ otherState, "event" };
+        state.copyPropertiesFrom(otherState, nullptr);
+
+        source.trigger();
+        expectEquals(numTriggers, 2);
+        expectEquals(event.getAssumedTriggerCount(), 1);
+
+        // Triggering after the channel's been removed stores a new one, which
+        // every Event on the property then shares
+        state.removeProperty("event", nullptr);
+        event.trigger();
+        expectEquals(numTriggers, 4);
+        expectEquals(sibling.getAssumedTriggerCount(), 1);
+        expect(state["event"] != otherState["event"]);
+    }
+
+    void testSubscriptions()
+    {
+        beginTest("subscriptions");
+
+        struct Listener : public jive::Object::Listener
+        {
+            void propertyChanged(jive::Object&, const juce::Identifier&) final
+            {
+                numChanges++;
+            }
+
+            int numChanges = 0;
+        };
+
+        juce::ValueTree state{ "State" };
+        auto event = std::make_unique<jive::Event>(state, "event");
+        auto* channel = dynamic_cast<jive::EventChannel*>(state["event"].getDynamicObject());
+        expect(channel != nullptr);
+        expectEquals(channel->getNumSubscribers(), 1);
+
+        Listener listener;
+        channel->addListener(listener);
+        event->trigger();
+        expectEquals(listener.numChanges, 0);
+        expectEquals(event->getAssumedTriggerCount(), 1);
+
+        auto destroyedWhileTriggering = std::make_unique<jive::Event>(state, "event");
+        auto numDestroyedTriggers = 0;
+        destroyedWhileTriggering->onTrigger = [&numDestroyedTriggers] {
+            numDestroyedTriggers++;
+        };
+
+        std::unique_ptr<jive::Event> subscribedWhileTriggering;
+        auto numLateTriggers = 0;
+        event->onTrigger = [&] {
+            destroyedWhileTriggering.reset();
+
+            if (subscribedWhileTriggering == nullptr)
+            {
+                subscribedWhileTriggering = std::make_unique<jive::Event>(state, "event");
+                subscribedWhileTriggering->onTrigger = [&numLateTriggers] {
+                    numLateTriggers++;
+                };
+            }
+        };
+        event->trigger();
+        expectEquals(numDestroyedTriggers, 0);
+        expectEquals(numLateTriggers, 0);
+        expectEquals(channel->getNumSubscribers(), 2);
+
+        event->trigger();
+        expectEquals(numLateTriggers, 1);
+        expectEquals(subscribedWhileTriggering->getAssumedTriggerCount(), 3);
+
+        channel->removeListener(listener);
+    }
+
+    void testCallbacksVar()
+    {
+        beginTest("callbacks var");
+
+        juce::ValueTree state{ "State" };
+        jive::Event event{ state, "event" };
+        auto wasTriggered = false;
+        event.onTrigger = [&wasTriggered] {
+            wasTriggered = true;
+        };
+
+        auto* channel = dynamic_cast<jive::EventChannel*>(state["event"].getDynamicObject());
+        const auto callbacks = channel->createCallbacksVar();
+        expect(callbacks.isArray());
+        expectEquals(callbacks.size(), 1);
+
+        const auto& callback = (*callbacks.getArray())[0];
+        callback.getNativeFunction()(juce::var::NativeFunctionArgs{ callback, nullptr, 0 });
+        expect(wasTriggered);
+    }
+
+    void testScriptProperties()
+    {
+        beginTest("script properties");
+
+        juce::ValueTree state{ "State" };
+        jive::Event event{ state, "event" };
+        auto numTriggers = 0;
+        event.onTrigger = [&numTriggers] {
+            numTriggers++;
+        };
+
+        const auto* channel = state["event"].getDynamicObject();
+        expect(channel->hasProperty("callbacks"));
+        expect(!channel->hasProperty("count"));
+        expect(!channel->hasProperty("time"));
+
+        event.trigger();
+        event.trigger();
+        expect(channel->hasProperty("count"));
+        expectEquals(static_cast<int>(channel->getProperty("count")), 2);
+        expect(channel->hasProperty("time"));
+        expectEquals(static_cast<juce::int64>(channel->getProperty("time")),
+                     event.getTimeLastTriggered().toMilliseconds());
+
+        const auto callbacks = channel->getProperty("callbacks");
+        expectEquals(callbacks.size(), 1);
+
+        const auto& callback = (*callbacks.getArray())[0];
+        callback.getNativeFunction()(juce::var::NativeFunctionArgs{ callback, nullptr, 0 });
+        expectEquals(numTriggers, 3);
+    }
 };
 
 static EventUnitTest eventUnitTest;
@@ -4,106 +4,107 @@
 
 namespace jive
 {
-    class Event : protected juce::ValueTree::Listener
+    class Event;
+
+    /** The state shared by every Event that refers to the same property of a
+        ValueTree.
+
+        Events are triggered on every click of a button, and continuously
+        while a slider is dragged, so the channel keeps its subscribers,
+        trigger count and timestamp as plain members rather than as properties
+        of the object - triggering doesn't notify the object's listeners, and
+        doesn't allocate. Script-facing code can still read them, as the
+        "callbacks", "count" and "time" properties, which are only built when
+        they're asked for.
+    */
+    class EventChannel : public Object
     {
     public:
-        Event() = delete;
+        using ReferenceCountedPointer = juce::ReferenceCountedObjectPtr<EventChannel>;
 
-        Event(juce::ValueTree sourceState, const juce::Identifier& eventID)
-            : id{ eventID }
-            , event{ sourceState, eventID }
+        struct Subscription
         {
-            if (!event.exists())
-                event = new Object{};
-
-            auto callbacks = event.get()->getProperty("callbacks");
-
-            callbacks.append(juce::var{
-                [weakThis = juce::WeakReference{ this }](const juce::var::NativeFunctionArgs&) {
-                    if (weakThis != nullptr && weakThis->onTrigger != nullptr)
-                        weakThis->onTrigger();
-
-                    return juce::var{};
-                },
-            });
-
-            event.get()->setProperty("callbacks", callbacks);
-        }
+            std::size_t index{ 0 };
+            std::uint32_t generation{ 0 };
+        };
 
-        Event(const Event& other)
-            : event{ other.event }
-        {
-        }
+        [[nodiscard]] Subscription subscribe(Event& event);
+        void unsubscribe(const Subscription& subscription);
 
-        Event(Event&& other)
-            : event{ std::move(other.event) }
-        {
-        }
+        void trigger();
 
-        Event& operator=(const Event& other)
-        {
-            event = other.event.get();
-            return *this;
-        }
+        [[nodiscard]] int getTriggerCount() const noexcept;
+        [[nodiscard]] juce::Time getTimeLastTriggered() const noexcept;
+        [[nodiscard]] int getNumSubscribers() const noexcept;
 
-        Event& operator=(Event&& other) = delete;
-        ~Event() = default;
+        /** Returns an array with a NativeFunction for each subscribed Event. */
+        [[nodiscard]] juce::var createCallbacksVar() const;
 
-        int getAssumedTriggerCount() const
-        {
-            if (!event.get()->hasProperty("count"))
-                return 0;
+        bool hasProperty(const juce::Identifier& propertyName) const override;
+        const juce::var& getProperty(const juce::Identifier& propertyName) const override;
 
-            return static_cast<int>(event.get()->getProperty("count"));
-        }
+        static inline const juce::Identifier callbacksID{ "callbacks" };
+        static inline const juce::Identifier countID{ "count" };
+        static inline const juce::Identifier timeID{ "time" };
 
-        juce::Time getTimeLastTriggered() const
+    private:
+        struct Subscriber
         {
-            if (!event.get()->hasProperty("time"))
-                return juce::Time{};
+            Event* event;
+            std::uint32_t generation;
+        };
+
+        std::vector<Subscriber> subscribers;
+        std::uint32_t latestGeneration{ 0 };
+        int triggerCount{ 0 };
+        juce::int64 timeLastTriggered{ 0 };
+
+        // getProperty() returns a reference, so the values it builds are kept
+        // until it's next asked for the same property
+        mutable juce::var callbacksVar;
+        mutable juce::var countVar;
+        mutable juce::var timeVar;
+    };
 
-            return juce::Time{
-                static_cast<juce::int64>(event.get()->getProperty("time")),
-            };
-        }
+    /** Triggers, and is told about triggers of, the EventChannel stored in a
+        property of a ValueTree.
 
-        void trigger()
-        {
-            event
-                .get()
-                ->setProperty("count", getAssumedTriggerCount() + 1);
-            event
-                .get()
-                ->setProperty("time", juce::Time::currentTimeMillis());
-
-            for (auto& callback : *event.get()->getProperty("callbacks").getArray())
-            {
-                callback.getNativeFunction()(juce::var::NativeFunctionArgs{
-                    callback,
-                    nullptr,
-                    0,
-                });
-            }
-        }
-
-        void triggerWithoutSelfCallback()
-        {
-            const auto callback = onTrigger;
-            onTrigger = nullptr;
+        If the property is replaced, e.g. by assigning another Event or from
+        a script, the Event moves to the new channel.
+    */
+    class Event : private juce::ValueTree::Listener
+    {
+    public:
+        Event() = delete;
+        Event(juce::ValueTree sourceState, const juce::Identifier& eventID);
+        Event(const Event& other);
+        Event(Event&& other);
+        Event& operator=(const Event& other);
+        Event& operator=(Event&& other) = delete;
+        ~Event() override;
 
-            juce::WeakReference weakThis{ this };
-            trigger();
+        int getAssumedTriggerCount() const;
+        juce::Time getTimeLastTriggered() const;
 
-            if (weakThis != nullptr)
-                weakThis->onTrigger = callback;
-        }
+        void trigger();
+        void triggerWithoutSelfCallback();
 
         const juce::Identifier id;
 
         std::function<void()> onTrigger = nullptr;
 
     private:
-        Property<Object::ReferenceCountedPointer> event;
+        [[nodiscard]] static EventChannel::ReferenceCountedPointer getOrCreateChannel(juce::ValueTree& tree,
+                                                                                      const juce::Identifier& eventID);
+        void subscribeTo(EventChannel::ReferenceCountedPointer newChannel);
+        void listenToState();
+
+        void valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& property) final;
+
+        juce::ValueTree state;
+        std::shared_ptr<PropertyDispatcher> dispatcher;
+        EventChannel::ReferenceCountedPointer channel;
+        EventChannel::Subscription subscription;
 
         JUCE_DECLARE_WEAK_REFERENCEABLE(Event)
     };
@@ -4,61 +4,9 @@
 
 namespace jive
 {
-    class Object::InternalListener : public Object::Listener
-    {
-    public:
-        explicit InternalListener(Object& obj)
-            : object{ obj }
-        {
-            for (const auto& nested : findNestedObjects())
-                nested->addListener(*this);
-
-            object.addListener(*this);
-        }
-
-        void propertyChanged(Object& objectThatChanged,
-                             const juce::Identifier& propertyName) final
-        {
-            if (&objectThatChanged == &object)
-            {
-                for (const auto& nested : findNestedObjects())
-                    nested->addListener(*this);
-            }
-            else
-            {
-                object.listeners.callExcluding(this,
-                                               &Listener::propertyChanged,
-                                               objectThatChanged,
-                                               propertyName);
-            }
-        }
-
-    private:
-        juce::Array<Object*> findNestedObjects()
-        {
-            juce::Array<Object*> nestedObjects;
-
-            for (auto& [name, value] : object.getProperties())
-            {
-                if (auto* nested = dynamic_cast<Object*>(value.getDynamicObject()))
-                {
-                    nestedObjects.add(nested);
-                }
-            }
-
-            return nestedObjects;
-        }
-
-        Object& object;
-    };
-
-    Object::Object()
-        : internalListener{ std::make_unique<InternalListener>(*this) }
-    {
-    }
+    Object::Object() = default;
 
     Object::Object(std::initializer_list<juce::NamedValueSet::NamedValue> initialProperties)
-        : internalListener{ std::make_unique<InternalListener>(*this) }
     {
         for (auto& pair : initialProperties)
             setProperty(pair.name, pair.value);
@@ -66,14 +14,33 @@ namespace jive
 
     Object::Object(const Object& other)
         : juce::DynamicObject{ dynamic_cast<const DynamicObject&>(other) }
-        , internalListener{ std::make_unique<InternalListener>(*this) }
     {
+        for (auto& [name, value] : getProperties())
+        {
+            if (auto* child = dynamic_cast<Object*>(value.getDynamicObject()))
+                hold(*child);
+        }
     }
 
     Object::Object(Object&& other)
         : juce::DynamicObject{ std::move(dynamic_cast<DynamicObject&&>(other)) }
-        , internalListener{ std::make_unique<InternalListener>(*this) }
     {
+        for (auto& [name, value] : getProperties())
+        {
+            auto* child = dynamic_cast<Object*>(value.getDynamicObject());
+
+            if (child == nullptr)
+                continue;
+
+            if (child->parent == &other)
+                child->parent = this;
+
+            for (auto& childHold : child->holds)
+            {
+                if (childHold.holder == &other)
+                    childHold.holder = this;
+            }
+        }
     }
 
     Object::Object(const juce::DynamicObject& other)
@@ -81,17 +48,51 @@ namespace jive
     {
     }
 
+    Object::~Object()
+    {
+        // Nested objects may outlive this one, so they mustn't be left
+        // pointing at it
+        for (auto& [name, value] : getProperties())
+            releaseIfObject(value);
+    }
+
     void Object::setProperty(const juce::Identifier& propertyName,
                              const juce::var& newValue)
     {
-        if (auto* childObject = dynamic_cast<Object*>(newValue.getDynamicObject()))
-            childObject->parent = this;
+        auto* const previousChild = dynamic_cast<Object*>(getProperties()[propertyName].getDynamicObject());
+        auto* const newChild = dynamic_cast<Object*>(newValue.getDynamicObject());
+
+        if (previousChild != newChild)
+        {
+            if (previousChild != nullptr)
+                release(*previousChild);
+
+            if (newChild != nullptr)
+            {
+                hold(*newChild);
+                newChild->parent = this;
+            }
+        }
 
         const auto propertyChanged = DynamicObject::getProperties()
                                          .set(propertyName, newValue);
 
         if (propertyChanged)
-            listeners.call(&Listener::propertyChanged, *this, propertyName);
+            informListeners(*this, propertyName);
+    }
+
+    void Object::removeProperty(const juce::Identifier& propertyName)
+    {
+        releaseIfObject(getProperties()[propertyName]);
+        DynamicObject::removeProperty(propertyName);
+    }
+
+    void Object::clear()
+    {
+        for (auto& [name, value] : getProperties())
+            releaseIfObject(value);
+
+        DynamicObject::clear();
     }
 
     const juce::NamedValueSet& Object::getProperties() const
@@ -140,6 +141,55 @@ namespace jive
         return getProperties()[name];
     }
 
+    void Object::informListeners(Object& objectThatChanged, const juce::Identifier& propertyName)
+    {
+        listeners.call(&Listener::propertyChanged, objectThatChanged, propertyName);
+
+        // Changes to nested objects are reported to the listeners of every
+        // object holding them, and so on up. A listener may release a hold,
+        // so the holds are indexed rather than iterated.
+        for (std::size_t i = 0; i < std::size(holds); i++)
+            holds[i].holder->informListeners(objectThatChanged, propertyName);
+    }
+
+    void Object::hold(Object& child)
+    {
+        for (auto& childHold : child.holds)
+        {
+            if (childHold.holder == this)
+            {
+                childHold.count++;
+                return;
+            }
+        }
+
+        child.holds.push_back({ this, 1 });
+    }
+
+    void Object::release(Object& child)
+    {
+        const auto childHold = std::find_if(std::begin(child.holds),
+                                            std::end(child.holds),
+                                            [this](const auto& candidate) {
+                                                return candidate.holder == this;
+                                            });
+
+        // The child is still held under another name
+        if (childHold == std::end(child.holds) || --childHold->count > 0)
+            return;
+
+        child.holds.erase(childHold);
+
+        if (child.parent == this)
+            child.parent = nullptr;
+    }
+
+    void Object::releaseIfObject(const juce::var& value)
+    {
+        if (auto* child = dynamic_cast<Object*>(value.getDynamicObject()))
+            release(*child);
+    }
+
     static void replaceDynamicObjectsWithJiveObjects(juce::var& value)
     {
         if (auto* dynamicObject = value.getDynamicObject())
@@ -203,6 +253,10 @@ public:
     void runTest() final
     {
         testListener();
+        testNestedListeners();
+        testCopies();
+        testRemovingNestedObjects();
+        testHoldingUnderSeveralNames();
         testJsonParsing();
         testInitialiserListConstruction();
     }
@@ -248,6 +302,168 @@ private:
         expect(callbackCalled);
     }
 
+    void testNestedListeners()
+    {
+        beginTest("nested listeners");
+
+        jive::Object root;
+        jive::Object::ReferenceCountedPointer hover = new jive::Object;
+        jive::Object::ReferenceCountedPointer disabled = new jive::Object;
+        root.setProperty("hover", hover.get());
+        hover->setProperty("disabled", disabled.get());
+        expect(disabled->getRoot() == &root);
+
+        Listener listener;
+        root.addListener(listener);
+
+        auto numCallbacks = 0;
+        listener.onPropertyChange = [&numCallbacks]() {
+            numCallbacks++;
+        };
+
+        disabled->setProperty("background", "red");
+        expectEquals(numCallbacks, 1);
+
+        jive::Object::ReferenceCountedPointer replacement = new jive::Object;
+        hover->setProperty("disabled", replacement.get());
+        expectEquals(numCallbacks, 2);
+        expect(disabled->getParent() == nullptr);
+
+        disabled->setProperty("background", "blue");
+        expectEquals(numCallbacks, 2);
+
+        replacement->setProperty("background", "green");
+        expectEquals(numCallbacks, 3);
+
+        {
+            jive::Object temporaryParent;
+            temporaryParent.setProperty("child", disabled.get());
+        }
+
+        expect(disabled->getParent() == nullptr);
+    }
+
+    void testCopies()
+    {
+        beginTest("copies");
+
+        jive::Object original;
+        jive::Object::ReferenceCountedPointer nested = new jive::Object;
+        original.setProperty("hover", nested.get());
+
+        Listener originalListener;
+        auto numOriginalCallbacks = 0;
+        originalListener.onPropertyChange = [&numOriginalCallbacks] {
+            numOriginalCallbacks++;
+        };
+        original.addListener(originalListener);
+
+        {
+            jive::Object copy{ original };
+            expect(nested->getParent() == &original);
+
+            Listener copyListener;
+            auto numCopyCallbacks = 0;
+            copyListener.onPropertyChange = [&numCopyCallbacks] {
+                numCopyCallbacks++;
+            };
+            copy.addListener(copyListener);
+
+            nested->setProperty("background", "red");
+            expectEquals(numOriginalCallbacks, 1);
+            expectEquals(numCopyCallbacks, 1);
+
+            // Replacing the nested object in the copy leaves the original's
+            // nested object alone
+            copy.setProperty("hover", new jive::Object);
+            nested->setProperty("background", "green");
+            expectEquals(numOriginalCallbacks, 2);
+            expectEquals(numCopyCallbacks, 2);
+
+            copy.removeListener(copyListener);
+        }
+
+        {
+            jive::Object copy{ original };
+        }
+
+        nested->setProperty("background", "blue");
+        expectEquals(numOriginalCallbacks, 3);
+        expect(nested->getParent() == &original);
+
+        original.removeListener(originalListener);
+    }
+
+    void testRemovingNestedObjects()
+    {
+        beginTest("removing nested objects");
+
+        jive::Object::ReferenceCountedPointer nested = new jive::Object;
+        auto numCallbacks = 0;
+        Listener listener;
+        listener.onPropertyChange = [&numCallbacks] {
+            numCallbacks++;
+        };
+
+        {
+            jive::Object parent;
+            parent.setProperty("hover", nested.get());
+            parent.addListener(listener);
+
+            parent.removeProperty("hover");
+            expect(nested->getParent() == nullptr);
+
+            nested->setProperty("background", "red");
+            expectEquals(numCallbacks, 0);
+
+            parent.setProperty("hover", nested.get());
+            parent.clear();
+            expect(nested->getParent() == nullptr);
+
+            numCallbacks = 0;
+            nested->setProperty("background", "blue");
+            expectEquals(numCallbacks, 0);
+
+            parent.removeListener(listener);
+        }
+
+        // The former parent is gone, so nothing may be told about this
+        nested->setProperty("background", "green");
+        expectEquals(numCallbacks, 0);
+    }
+
+    void testHoldingUnderSeveralNames()
+    {
+        beginTest("holding under several names");
+
+        jive::Object parent;
+        jive::Object::ReferenceCountedPointer nested = new jive::Object;
+        parent.setProperty("hover", nested.get());
+        parent.setProperty("focus", nested.get());
+
+        Listener listener;
+        auto numCallbacks = 0;
+        listener.onPropertyChange = [&numCallbacks] {
+            numCallbacks++;
+        };
+        parent.addListener(listener);
+
+        parent.setProperty("hover", new jive::Object);
+        expectEquals(numCallbacks, 1);
+        expect(nested->getParent() == &parent);
+
+        nested->setProperty("background", "red");
+        expectEquals(numCallbacks, 2);
+
+        parent.removeProperty("focus");
+        expect(nested->getParent() == nullptr);
+
+        nested->setProperty("background", "green");
+        expectEquals(numCallbacks, 2);
+
+        parent.removeListener(listener);
+    }
+
     void testJsonParsing()
     {
         beginTest("JSON parsing");
@@ -4,6 +4,14 @@
 
 namespace jive
 {
+    /** A DynamicObject whose listeners are also told about changes to the
+        Objects nested inside it.
+
+        A nested Object's parent is the Object it was last set on, for as long
+        as that Object holds it under any name. Copies share their nested
+        Objects with the original, which stays their parent, but the copies'
+        listeners are still told when they change.
+    */
     class Object : public juce::DynamicObject
     {
     public:
@@ -22,9 +30,12 @@ namespace jive
         Object(const Object& other);
         Object(Object&& other);
         Object(const juce::DynamicObject& other);
+        ~Object() override;
 
         void setProperty(const juce::Identifier& propertyName,
                          const juce::var& newValue) override;
+        void removeProperty(const juce::Identifier& propertyName) override;
+        void clear();
         const juce::NamedValueSet& getProperties() const;
 
         Object* getParent() noexcept;
@@ -38,11 +49,20 @@ namespace jive
         const juce::var& operator[](const juce::Identifier& name) const noexcept;
 
     private:
-        class InternalListener;
+        struct Hold
+        {
+            Object* holder;
+            int count;
+        };
+
+        void informListeners(Object& objectThatChanged, const juce::Identifier& propertyName);
+        void hold(Object& child);
+        void release(Object& child);
+        void releaseIfObject(const juce::var& value);
 
         mutable juce::ListenerList<Listener> listeners;
-        const std::unique_ptr<Listener> internalListener;
         Object* parent = nullptr;
+        std::vector<Hold> holds;
 
         JUCE_LEAK_DETECTOR(Object)
     };
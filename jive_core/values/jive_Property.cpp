@@ -67,6 +67,15 @@ private:
         tree.setProperty("value", 2.46f, nullptr);
 
         expect(callbackCalled);
+
+        callbackCalled = false;
+        const auto copy = value;
+        tree.setProperty("value", 3.69f, nullptr);
+        expect(callbackCalled);
+
+        value.onValueChange = std::function<void()>{};
+        expect(value.onValueChange == nullptr);
+        expect(copy.onValueChange != nullptr);
     }
 
     void testHereditaryValues()
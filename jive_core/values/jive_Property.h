@@ -2,10 +2,13 @@
 
 #include "jive_Object.h"
 #include "jive_PropertyBehaviours.h"
+#include "jive_PropertyCallback.h"
+#include "jive_PropertyDispatcher.h"
 #include "variant-converters/jive_VariantConvertion.h"
 
 #include <jive_core/algorithms/jive_Visitor.h>
 #include <jive_core/kinetics/jive_Transitions.h>
+#include <jive_core/memory/jive_BlockPool.h>
 
 namespace jive
 {
@@ -27,7 +30,6 @@ namespace jive
     class Property
         : protected juce::ValueTree::Listener
         , protected Object::Listener
-        , private Transition::Listener
     {
     public:
         using Source = std::variant<juce::ValueTree, Object::ReferenceCountedPointer>;
@@ -36,27 +38,29 @@ namespace jive
                  const juce::Identifier& propertyID)
             : id{ propertyID }
             , source{ propertySource }
-            , transitionSourceID{ propertyID }
         {
+            JIVE_INSTRUMENT(propertiesCreated, 1);
             initialise();
         }
 
         Property(const Property& other)
             : id{ other.id }
         {
+            JIVE_INSTRUMENT(propertiesCreated, 1);
             *this = other;
         }
 
         Property(Property&& other)
             : id{ std::move(other.id) }
         {
+            JIVE_INSTRUMENT(propertiesCreated, 1);
             *this = std::move(other);
         }
 
         Property& operator=(const Property& other)
         {
             jassert(id == other.id);
-            transitionSourceID = other.transitionSourceID;
+            copyTransitionSourceFrom(other);
             source = other.source;
             onValueChange = other.onValueChange;
 
@@ -68,7 +72,7 @@ namespace jive
         Property& operator=(Property&& other)
         {
             jassert(id == other.id);
-            transitionSourceID = std::move(other.transitionSourceID);
+            copyTransitionSourceFrom(other);
             source = std::move(other.source);
             onValueChange = std::move(other.onValueChange);
 
@@ -79,9 +83,9 @@ namespace jive
 
         ~Property() override
         {
+            JIVE_INSTRUMENT(propertiesDestroyed, 1);
             observeTransition(nullptr);
-            removeThisAsListener(source);
-            removeThisAsListener(listenerTarget);
+            removeThisAsListener();
         }
 
         [[nodiscard]] virtual ValueType get() const
@@ -198,7 +202,9 @@ namespace jive
         void setTransitionSourceProperty(const juce::Identifier& sourceID)
         {
             observeTransition(nullptr);
-            transitionSourceID = sourceID;
+
+            if (sourceID != getTransitionSourceID())
+                getTransitionState().sourceID = sourceID;
 
             if (auto* transition = getTransition())
                 observeTransition(transition);
@@ -206,7 +212,7 @@ namespace jive
 
         [[nodiscard]] Transition* getTransition()
         {
-            if (currentTransition == nullptr)
+            if (transitionState == nullptr || transitionState->current == nullptr)
             {
                 using TransitionsProperty = Property<Transitions::ReferenceCountedPointer,
                                                      Inheritance::doNotInherit,
@@ -214,10 +220,18 @@ namespace jive
                                                      true,
                                                      Responsiveness::ignoreChanges>;
 
-                if (const TransitionsProperty transitions{ source, "transition" }; transitions.exists())
-                    currentTransition = (*transitions.get())[transitionSourceID.toString()];
+                if (const TransitionsProperty transitions{ source, transitionID }; transitions.exists())
+                {
+                    if (auto* transition = (*transitions.get())[getTransitionSourceID()])
+                        getTransitionState().current = transition;
+                }
             }
 
+            if (transitionState == nullptr)
+                return nullptr;
+
+            auto* const currentTransition = transitionState->current;
+
             if (currentTransition != nullptr && currentTransition->source.isVoid())
             {
                 currentTransition->source = getVar(source, id);
@@ -262,8 +276,8 @@ namespace jive
         }
 
         const juce::Identifier id;
-        mutable std::function<void(void)> onValueChange = nullptr;
-        mutable std::function<void(void)> onTransitionProgressed = nullptr;
+        mutable PropertyCallback onValueChange;
+        mutable PropertyCallback onTransitionProgressed;
 
     protected:
         void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
@@ -271,8 +285,8 @@ namespace jive
         {
             if (property != id)
             {
-                if (property.toString() == "transition")
-                    currentTransition = getTransition();
+                if (property == transitionID)
+                    resetTransition();
 
                 return;
             }
@@ -564,32 +578,49 @@ namespace jive
                               src);
         }
 
-        void addThisAsListener(Source& src)
+        void addThisAsListener(const Source& src)
         {
+            removeThisAsListener();
+
             std::visit(Visitor{
-                           [this](juce::ValueTree& sourceTree) {
-                               sourceTree.addListener(this);
+                           [this](const juce::ValueTree& sourceTree) {
+                               dispatcher = PropertyDispatcher::getFor(sourceTree);
+
+                               if (dispatcher == nullptr)
+                                   return;
+
+                               dispatcher->addListener(id, *this);
+
+                               if (id != transitionID)
+                                   dispatcher->addListener(transitionID, *this);
                            },
                            [this](const Object::ReferenceCountedPointer& sourceObject) {
-                               if (sourceObject != nullptr)
-                                   sourceObject->addListener(*this);
+                               observedObject = sourceObject;
+
+                               if (observedObject != nullptr)
+                                   observedObject->addListener(*this);
                            },
                        },
                        src);
         }
 
-        void removeThisAsListener(Source& src)
+        void removeThisAsListener()
         {
-            std::visit(Visitor{
-                           [this](juce::ValueTree& sourceTree) {
-                               sourceTree.removeListener(this);
-                           },
-                           [this](const Object::ReferenceCountedPointer& sourceObject) {
-                               if (sourceObject != nullptr)
-                                   sourceObject->removeListener(*this);
-                           },
-                       },
-                       src);
+            if (dispatcher != nullptr)
+            {
+                dispatcher->removeListener(id, *this);
+
+                if (id != transitionID)
+                    dispatcher->removeListener(transitionID, *this);
+
+                dispatcher = nullptr;
+            }
+
+            if (observedObject != nullptr)
+            {
+                observedObject->removeListener(*this);
+                observedObject = nullptr;
+            }
         }
 
         void set(Source& src, const juce::var& value)
@@ -610,15 +641,71 @@ namespace jive
         Source source;
 
     private:
-        void initialise()
+        struct TransitionState : private Transition::Listener
         {
-            listenerTarget = findListenerTarget(source);
+            TransitionState(Property& transitioningProperty, const juce::Identifier& transitionSourceID)
+                : property{ transitioningProperty }
+                , sourceID{ transitionSourceID }
+            {
+            }
 
-            if (!isValid(listenerTarget))
-                listenerTarget = source;
+            ~TransitionState() override
+            {
+                observe(nullptr);
+            }
+
+            [[nodiscard]] static void* operator new(std::size_t size)
+            {
+                return BlockPool::getItemPool().allocate(size);
+            }
 
+            static void operator delete(void* block, std::size_t size) noexcept
+            {
+                BlockPool::getItemPool().deallocate(block, size);
+            }
+
+            void observe(Transition* transition)
+            {
+                if (observed == transition)
+                    return;
+
+                if (observed != nullptr)
+                    observed->removeListener(*this);
+
+                observed = transition;
+
+                if (transition != nullptr)
+                    transition->addListener(*this);
+            }
+
+            void transitionProgressed(const juce::Identifier& propertyName,
+                                      const Transition&) final
+            {
+                jassertquiet(propertyName == sourceID);
+
+                property.transitionProgressed();
+
+                if (property.onTransitionProgressed != nullptr)
+                    property.onTransitionProgressed();
+            }
+
+            Property& property;
+            juce::Identifier sourceID;
+            Transition* current = nullptr;
+            Transition* observed = nullptr;
+        };
+
+        void initialise()
+        {
             if constexpr (responsiveness == Responsiveness::respondToChanges)
+            {
+                auto listenerTarget = findListenerTarget(source);
+
+                if (!isValid(listenerTarget))
+                    listenerTarget = source;
+
                 addThisAsListener(listenerTarget);
+            }
 
             if constexpr (autoParseStrings)
             {
@@ -630,17 +717,6 @@ namespace jive
                 updateTransition();
         }
 
-        void transitionProgressed(const juce::String& propertyName,
-                                  const Transition&) final
-        {
-            jassertquiet(propertyName == transitionSourceID.toString());
-
-            transitionProgressed();
-
-            if (onTransitionProgressed != nullptr)
-                onTransitionProgressed();
-        }
-
         void valueChanged()
         {
             if constexpr (!std::is_same<ValueType, Transitions::ReferenceCountedPointer>())
@@ -677,23 +753,51 @@ namespace jive
             }
         }
 
+        void resetTransition()
+        {
+            if (transitionState != nullptr)
+            {
+                transitionState->observe(nullptr);
+                transitionState->current = nullptr;
+            }
+
+            // Looking the new transition up straight away records the current
+            // value as its starting point, so the next change animates from it
+            observeTransition(getTransition());
+        }
+
         void observeTransition(Transition* transition)
         {
-            if (observedTransition == transition)
-                return;
+            if (transitionState != nullptr)
+                transitionState->observe(transition);
+        }
 
-            if (observedTransition != nullptr)
-                observedTransition->removeListener(*this);
+        [[nodiscard]] TransitionState& getTransitionState()
+        {
+            if (transitionState == nullptr)
+                transitionState = std::make_unique<TransitionState>(*this, id);
 
-            observedTransition = transition;
+            return *transitionState;
+        }
 
-            if (transition != nullptr)
-                transition->addListener(*this);
+        [[nodiscard]] const juce::Identifier& getTransitionSourceID() const
+        {
+            return transitionState != nullptr ? transitionState->sourceID : id;
         }
 
-        Source listenerTarget;
-        juce::Identifier transitionSourceID;
-        Transition* currentTransition = nullptr;
-        Transition* observedTransition = nullptr;
+        void copyTransitionSourceFrom(const Property& other)
+        {
+            if (other.getTransitionSourceID() != getTransitionSourceID())
+                getTransitionState().sourceID = other.getTransitionSourceID();
+        }
+
+        std::shared_ptr<PropertyDispatcher> dispatcher;
+        Object::ReferenceCountedPointer observedObject;
+
+        // Only allocated once a transition applies to this property, or
+        // its transition source differs from its ID
+        std::unique_ptr<TransitionState> transitionState;
+
+        static inline const juce::Identifier transitionID{ "transition" };
     };
 } // namespace jive
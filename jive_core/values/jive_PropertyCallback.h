@@ -0,0 +1,85 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace jive
+{
+    /** A nullable callback that takes up a single pointer until it's set.
+
+        Most Properties never have their callbacks set, so keeping the
+        std::function out of line saves several pointers per Property.
+    */
+    class PropertyCallback
+    {
+    public:
+        PropertyCallback() = default;
+
+        PropertyCallback(const PropertyCallback& other)
+            : function{ copy(other.function) }
+        {
+        }
+
+        PropertyCallback(PropertyCallback&&) noexcept = default;
+
+        PropertyCallback& operator=(const PropertyCallback& other)
+        {
+            if (this != &other)
+                function = copy(other.function);
+
+            return *this;
+        }
+
+        PropertyCallback& operator=(PropertyCallback&&) noexcept = default;
+
+        PropertyCallback& operator=(std::nullptr_t)
+        {
+            function = nullptr;
+            return *this;
+        }
+
+        template <typename Callable,
+                  typename = std::enable_if_t<std::is_invocable_v<Callable&>
+                                              && !std::is_same_v<std::decay_t<Callable>, PropertyCallback>>>
+        PropertyCallback& operator=(Callable&& callable)
+        {
+            if constexpr (std::is_constructible_v<bool, const std::decay_t<Callable>&>)
+            {
+                if (!static_cast<bool>(callable))
+                {
+                    function = nullptr;
+                    return *this;
+                }
+            }
+
+            function = std::make_unique<std::function<void()>>(std::forward<Callable>(callable));
+            return *this;
+        }
+
+        void operator()() const
+        {
+            if (function != nullptr)
+                (*function)();
+        }
+
+        [[nodiscard]] friend bool operator==(const PropertyCallback& callback, std::nullptr_t)
+        {
+            return callback.function == nullptr;
+        }
+
+        [[nodiscard]] friend bool operator!=(const PropertyCallback& callback, std::nullptr_t)
+        {
+            return callback.function != nullptr;
+        }
+
+    private:
+        [[nodiscard]] static std::unique_ptr<std::function<void()>> copy(const std::unique_ptr<std::function<void()>>& function)
+        {
+            if (function == nullptr)
+                return nullptr;
+
+            return std::make_unique<std::function<void()>>(*function);
+        }
+
+        std::unique_ptr<std::function<void()>> function;
+    };
+} // namespace jive
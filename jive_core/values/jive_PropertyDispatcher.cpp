@@ -0,0 +1,306 @@
+#include "jive_PropertyDispatcher.h"
+
+#include "jive_PropertyTransaction.h"
+
+#include <jive_core/profiling/jive_Instrumentation.h>
+
+namespace jive
+{
+    PropertyDispatcher::PropertyDispatcher(const juce::ValueTree& treeToDispatchFrom)
+        : tree{ treeToDispatchFrom }
+    {
+        JIVE_INSTRUMENT(valueTreeListenersAdded, 1);
+        tree.addListener(this);
+    }
+
+    PropertyDispatcher::~PropertyDispatcher()
+    {
+        JIVE_INSTRUMENT(valueTreeListenersRemoved, 1);
+        tree.removeListener(this);
+    }
+
+    std::shared_ptr<PropertyDispatcher> PropertyDispatcher::getFor(const juce::ValueTree& tree)
+    {
+        if (!tree.isValid())
+            return nullptr;
+
+        // The Properties on a tree are almost always created together, so
+        // remembering a handful of recently used dispatchers shares them
+        // without having to index every tree. A miss only costs an extra
+        // listener on the tree.
+        static thread_local std::array<std::weak_ptr<PropertyDispatcher>, numRecentDispatchers> recentDispatchers;
+
+        for (auto recent = std::begin(recentDispatchers); recent != std::end(recentDispatchers); recent++)
+        {
+            if (auto dispatcher = recent->lock();
+                dispatcher != nullptr && dispatcher->tree == tree)
+            {
+                std::rotate(std::begin(recentDispatchers), recent, std::next(recent));
+                return dispatcher;
+            }
+        }
+
+        auto dispatcher = std::make_shared<PropertyDispatcher>(tree);
+        std::move_backward(std::begin(recentDispatchers),
+                           std::prev(std::end(recentDispatchers)),
+                           std::end(recentDispatchers));
+        recentDispatchers.front() = dispatcher;
+
+        return dispatcher;
+    }
+
+    void PropertyDispatcher::addListener(const juce::Identifier& property, juce::ValueTree::Listener& listener)
+    {
+        JIVE_INSTRUMENT(valueTreeListenersAdded, 1);
+        listeners[property].push_back(&listener);
+    }
+
+    void PropertyDispatcher::removeListener(const juce::Identifier& property, juce::ValueTree::Listener& listener)
+    {
+        const auto entry = listeners.find(property);
+
+        if (entry == std::end(listeners))
+            return;
+
+        auto& interested = entry->second;
+        const auto position = std::find(std::begin(interested), std::end(interested), &listener);
+
+        if (position == std::end(interested))
+            return;
+
+        JIVE_INSTRUMENT(valueTreeListenersRemoved, 1);
+
+        // Erasing while dispatching would skip the next listener
+        if (dispatchDepth > 0)
+        {
+            *position = nullptr;
+            hasDeadListeners = true;
+            return;
+        }
+
+        interested.erase(position);
+
+        if (interested.empty())
+            listeners.erase(entry);
+    }
+
+    const juce::ValueTree& PropertyDispatcher::getTree() const
+    {
+        return tree;
+    }
+
+    int PropertyDispatcher::getNumListeners(const juce::Identifier& property) const
+    {
+        const auto entry = listeners.find(property);
+
+        if (entry == std::end(listeners))
+            return 0;
+
+        return static_cast<int>(std::count_if(std::begin(entry->second),
+                                              std::end(entry->second),
+                                              [](const auto* listener) {
+                                                  return listener != nullptr;
+                                              }));
+    }
+
+    void PropertyDispatcher::valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                                      const juce::Identifier& property)
+    {
+        if (listeners.find(property) == std::end(listeners))
+            return;
+
+        if (PropertyTransaction::defer(*this, treeWhosePropertyChanged, property))
+            return;
+
+        dispatch(treeWhosePropertyChanged, property);
+    }
+
+    void PropertyDispatcher::dispatch(juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& property)
+    {
+        const auto entry = listeners.find(property);
+
+        if (entry == std::end(listeners))
+            return;
+
+        // A listener may release the last reference to this dispatcher
+        const auto keepAlive = weak_from_this().lock();
+        auto& interested = entry->second;
+
+        dispatchDepth++;
+
+        for (std::size_t i = 0; i < std::size(interested); i++)
+        {
+            if (auto* listener = interested[i])
+                listener->valueTreePropertyChanged(treeWhosePropertyChanged, property);
+        }
+
+        dispatchDepth--;
+
+        if (dispatchDepth == 0 && hasDeadListeners)
+            removeDeadListeners();
+    }
+
+    void PropertyDispatcher::removeDeadListeners()
+    {
+        for (auto entry = std::begin(listeners); entry != std::end(listeners);)
+        {
+            auto& interested = entry->second;
+            interested.erase(std::remove(std::begin(interested), std::end(interested), nullptr),
+                             std::end(interested));
+
+            if (interested.empty())
+                entry = listeners.erase(entry);
+            else
+                entry++;
+        }
+
+        hasDeadListeners = false;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+    #include "jive_Property.h"
+
+class PropertyDispatcherUnitTest : public juce::UnitTest
+{
+public:
+    PropertyDispatcherUnitTest()
+        : juce::UnitTest{ "jive::PropertyDispatcher", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testRouting();
+        testSharing();
+        testRemovingWhileDispatching();
+        testProperties();
+    }
+
+private:
+    struct CountingListener : juce::ValueTree::Listener
+    {
+        void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) override
+        {
+            numCalls++;
+
+            if (onChange != nullptr)
+                onChange();
+        }
+
+        int numCalls{ 0 };
+        std::function<void()> onChange;
+    };
+
+    void testRouting()
+    {
+        beginTest("routing");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::PropertyDispatcher dispatcher{ tree };
+        CountingListener widthListener;
+        CountingListener heightListener;
+        dispatcher.addListener("width", widthListener);
+        dispatcher.addListener("height", heightListener);
+        expectEquals(dispatcher.getNumListeners("width"), 1);
+
+        tree.setProperty("width", 100, nullptr);
+        expectEquals(widthListener.numCalls, 1);
+        expectEquals(heightListener.numCalls, 0);
+
+        juce::ValueTree child{ "Child" };
+        tree.appendChild(child, nullptr);
+        child.setProperty("height", 100, nullptr);
+        expectEquals(widthListener.numCalls, 1);
+        expectEquals(heightListener.numCalls, 1);
+
+        tree.setProperty("depth", 100, nullptr);
+        expectEquals(widthListener.numCalls, 1);
+        expectEquals(heightListener.numCalls, 1);
+
+        dispatcher.removeListener("width", widthListener);
+        expectEquals(dispatcher.getNumListeners("width"), 0);
+        tree.setProperty("width", 200, nullptr);
+        expectEquals(widthListener.numCalls, 1);
+    }
+
+    void testSharing()
+    {
+        beginTest("sharing");
+
+        juce::ValueTree tree{ "Tree" };
+        juce::ValueTree otherTree{ "Tree" };
+
+        const auto dispatcher = jive::PropertyDispatcher::getFor(tree);
+        expect(dispatcher != nullptr);
+        expect(jive::PropertyDispatcher::getFor(tree) == dispatcher);
+        expect(jive::PropertyDispatcher::getFor(otherTree) != dispatcher);
+        expect(jive::PropertyDispatcher::getFor(juce::ValueTree{}) == nullptr);
+    }
+
+    void testRemovingWhileDispatching()
+    {
+        beginTest("removing while dispatching");
+
+        juce::ValueTree tree{ "Tree" };
+        auto dispatcher = jive::PropertyDispatcher::getFor(tree);
+        CountingListener first;
+        CountingListener second;
+        CountingListener third;
+        dispatcher->addListener("value", first);
+        dispatcher->addListener("value", second);
+        dispatcher->addListener("value", third);
+
+        first.onChange = [&dispatcher, &second]() {
+            dispatcher->removeListener("value", second);
+        };
+        tree.setProperty("value", 1, nullptr);
+        expectEquals(first.numCalls, 1);
+        expectEquals(second.numCalls, 0);
+        expectEquals(third.numCalls, 1);
+        expectEquals(dispatcher->getNumListeners("value"), 2);
+
+        first.onChange = [&dispatcher]() {
+            dispatcher = nullptr;
+        };
+        tree.setProperty("value", 2, nullptr);
+        expectEquals(third.numCalls, 2);
+    }
+
+    void testProperties()
+    {
+        beginTest("properties");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> width{ tree, "width" };
+        jive::Property<int> height{ tree, "height" };
+
+        auto numWidthChanges = 0;
+        auto numHeightChanges = 0;
+        width.onValueChange = [&numWidthChanges]() {
+            numWidthChanges++;
+        };
+        height.onValueChange = [&numHeightChanges]() {
+            numHeightChanges++;
+        };
+
+        const auto dispatcher = jive::PropertyDispatcher::getFor(tree);
+        expectEquals(dispatcher->getNumListeners("width"), 1);
+        expectEquals(dispatcher->getNumListeners("height"), 1);
+
+        tree.setProperty("width", 10, nullptr);
+        expectEquals(numWidthChanges, 1);
+        expectEquals(numHeightChanges, 0);
+
+        {
+            const auto copy = width;
+            expectEquals(dispatcher->getNumListeners("width"), 2);
+        }
+
+        expectEquals(dispatcher->getNumListeners("width"), 1);
+    }
+};
+
+static PropertyDispatcherUnitTest propertyDispatcherUnitTest;
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <jive_core/algorithms/jive_Hash.h>
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace jive
+{
+    /** A single listener on a ValueTree that forwards property changes only
+        to the listeners that registered an interest in the property that
+        changed.
+
+        Properties use a shared dispatcher rather than listening to their tree
+        directly, so that changing one property on a tree only wakes the
+        Properties that read it, rather than every Property on that tree and,
+        for inherited properties, every Property beneath it.
+    */
+    class PropertyDispatcher
+        : public std::enable_shared_from_this<PropertyDispatcher>
+        , private juce::ValueTree::Listener
+    {
+    public:
+        explicit PropertyDispatcher(const juce::ValueTree& treeToDispatchFrom);
+        ~PropertyDispatcher() override;
+
+        /** Returns a dispatcher for the given tree, reusing one that's
+            recently been handed out for the same tree where possible.
+
+            Returns nullptr for invalid trees.
+        */
+        [[nodiscard]] static std::shared_ptr<PropertyDispatcher> getFor(const juce::ValueTree& tree);
+
+        void addListener(const juce::Identifier& property, juce::ValueTree::Listener& listener);
+        void removeListener(const juce::Identifier& property, juce::ValueTree::Listener& listener);
+
+        [[nodiscard]] const juce::ValueTree& getTree() const;
+        [[nodiscard]] int getNumListeners(const juce::Identifier& property) const;
+
+    private:
+        friend class PropertyTransaction;
+
+        void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& property) final;
+        void dispatch(juce::ValueTree& treeWhosePropertyChanged,
+                      const juce::Identifier& property);
+        void removeDeadListeners();
+
+        juce::ValueTree tree;
+        std::unordered_map<juce::Identifier, std::vector<juce::ValueTree::Listener*>> listeners;
+        int dispatchDepth{ 0 };
+        bool hasDeadListeners{ false };
+
+        static constexpr std::size_t numRecentDispatchers = 8;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PropertyDispatcher)
+    };
+} // namespace jive
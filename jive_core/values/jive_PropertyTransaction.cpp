@@ -0,0 +1,352 @@
+#include "jive_PropertyTransaction.h"
+
+#include "jive_PropertyDispatcher.h"
+
+#include <jive_core/algorithms/jive_Hash.h>
+
+namespace jive
+{
+    [[nodiscard]] static std::vector<PropertyTransaction*>& getTransactionsInProgress()
+    {
+        static thread_local std::vector<PropertyTransaction*> transactions;
+        return transactions;
+    }
+
+    [[nodiscard]] static std::size_t hashPropertyChange(const PropertyDispatcher& dispatcher,
+                                                        const juce::Identifier& property)
+    {
+        return hashAll(static_cast<const void*>(&dispatcher), property);
+    }
+
+    PropertyTransaction::PropertyTransaction(const juce::ValueTree& treeToBatch)
+        : tree{ treeToBatch }
+    {
+        getTransactionsInProgress().push_back(this);
+    }
+
+    PropertyTransaction::~PropertyTransaction()
+    {
+        // Changes made while delivering are added to this transaction, so
+        // they're coalesced too
+        deliverChanges();
+
+        // Reactions are called after all the changes have been delivered,
+        // and anything they trigger happens immediately
+        isCompleting = true;
+
+        for (std::size_t i = 0; i < std::size(reactions); i++)
+        {
+            if (const auto callback = reactions[i].callback; callback != nullptr)
+                callback();
+        }
+
+        auto& transactions = getTransactionsInProgress();
+        transactions.erase(std::remove(std::begin(transactions), std::end(transactions), this),
+                           std::end(transactions));
+    }
+
+    bool PropertyTransaction::deferUntilComplete(const juce::ValueTree& tree,
+                                                 const void* key,
+                                                 std::function<void()> callback)
+    {
+        auto* const transaction = findTransactionCovering(tree);
+
+        if (transaction == nullptr)
+            return false;
+
+        if (transaction->reactionKeys.insert(key).second)
+            transaction->reactions.push_back({ key, std::move(callback) });
+
+        return true;
+    }
+
+    void PropertyTransaction::cancel(const void* key)
+    {
+        for (auto* const transaction : getTransactionsInProgress())
+        {
+            if (transaction->reactionKeys.erase(key) == 0)
+                continue;
+
+            for (auto& reaction : transaction->reactions)
+            {
+                if (reaction.key == key)
+                    reaction.callback = nullptr;
+            }
+        }
+    }
+
+    void PropertyTransaction::flush(const juce::ValueTree& tree)
+    {
+        auto& transactions = getTransactionsInProgress();
+
+        for (std::size_t t = 0; t < std::size(transactions); t++)
+        {
+            auto& transaction = *transactions[t];
+
+            for (auto i = transaction.numDeliveredChanges; i < std::size(transaction.changes); i++)
+            {
+                if (transaction.changes[i].tree != tree)
+                    continue;
+
+                // Resetting the dispatcher marks the change as delivered
+                auto change = transaction.changes[i];
+                transaction.changes[i].dispatcher.reset();
+
+                if (auto dispatcher = change.dispatcher.lock())
+                    dispatcher->dispatch(change.tree, change.property);
+            }
+        }
+    }
+
+    bool PropertyTransaction::isInProgressFor(const juce::ValueTree& tree)
+    {
+        return findTransactionCovering(tree) != nullptr;
+    }
+
+    PropertyTransaction* PropertyTransaction::findTransactionCovering(const juce::ValueTree& tree)
+    {
+        for (auto* const transaction : getTransactionsInProgress())
+        {
+            if (transaction->isCompleting)
+                continue;
+
+            if (tree == transaction->tree || tree.isAChildOf(transaction->tree))
+                return transaction;
+        }
+
+        return nullptr;
+    }
+
+    bool PropertyTransaction::defer(PropertyDispatcher& dispatcher,
+                                    const juce::ValueTree& treeWhosePropertyChanged,
+                                    const juce::Identifier& property)
+    {
+        if (getTransactionsInProgress().empty())
+            return false;
+
+        // The change can only be delivered later if the dispatcher can be
+        // kept alive until then
+        if (dispatcher.weak_from_this().expired())
+            return false;
+
+        auto* const transaction = findTransactionCovering(treeWhosePropertyChanged);
+
+        if (transaction == nullptr)
+            return false;
+
+        transaction->addChange(dispatcher, treeWhosePropertyChanged, property);
+        return true;
+    }
+
+    void PropertyTransaction::addChange(PropertyDispatcher& dispatcher,
+                                        const juce::ValueTree& treeWhosePropertyChanged,
+                                        const juce::Identifier& property)
+    {
+        const auto hash = hashPropertyChange(dispatcher, property);
+        const auto [first, last] = changeIndices.equal_range(hash);
+
+        for (auto index = first; index != last; index++)
+        {
+            if (index->second < numDeliveredChanges)
+                continue;
+
+            const auto& change = changes[index->second];
+
+            if (change.property == property
+                && change.tree == treeWhosePropertyChanged
+                && change.dispatcher.lock().get() == &dispatcher)
+            {
+                return;
+            }
+        }
+
+        changeIndices.emplace(hash, std::size(changes));
+        changes.push_back({ dispatcher.weak_from_this(), treeWhosePropertyChanged, property });
+    }
+
+    void PropertyTransaction::deliverChanges()
+    {
+        while (numDeliveredChanges < std::size(changes))
+        {
+            // Delivering may add more changes, so copy this one first
+            auto change = changes[numDeliveredChanges++];
+
+            if (auto dispatcher = change.dispatcher.lock())
+                dispatcher->dispatch(change.tree, change.property);
+        }
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+    #include "jive_Property.h"
+
+class PropertyTransactionUnitTest : public juce::UnitTest
+{
+public:
+    PropertyTransactionUnitTest()
+        : juce::UnitTest{ "jive::PropertyTransaction", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCoalescing();
+        testSubtrees();
+        testNesting();
+        testChangesWhileCompleting();
+        testReactions();
+    }
+
+private:
+    void testCoalescing()
+    {
+        beginTest("coalescing");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> value{ tree, "value" };
+        auto numChanges = 0;
+        value.onValueChange = [&numChanges] {
+            numChanges++;
+        };
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            value = 1;
+            value = 2;
+            value = 3;
+            expectEquals(numChanges, 0);
+            expectEquals(value.get(), 3);
+            expect(jive::PropertyTransaction::isInProgressFor(tree));
+        }
+
+        expectEquals(numChanges, 1);
+        expect(!jive::PropertyTransaction::isInProgressFor(tree));
+
+        value = 4;
+        expectEquals(numChanges, 2);
+    }
+
+    void testSubtrees()
+    {
+        beginTest("subtrees");
+
+        juce::ValueTree parent{ "Parent" };
+        juce::ValueTree child{ "Child" };
+        juce::ValueTree unrelated{ "Unrelated" };
+        parent.appendChild(child, nullptr);
+
+        jive::Property<int> childValue{ child, "value" };
+        jive::Property<int> unrelatedValue{ unrelated, "value" };
+        auto numChildChanges = 0;
+        auto numUnrelatedChanges = 0;
+        childValue.onValueChange = [&numChildChanges] {
+            numChildChanges++;
+        };
+        unrelatedValue.onValueChange = [&numUnrelatedChanges] {
+            numUnrelatedChanges++;
+        };
+
+        {
+            const jive::PropertyTransaction transaction{ parent };
+            childValue = 1;
+            childValue = 2;
+            unrelatedValue = 1;
+            expectEquals(numChildChanges, 0);
+            expectEquals(numUnrelatedChanges, 1);
+        }
+
+        expectEquals(numChildChanges, 1);
+    }
+
+    void testNesting()
+    {
+        beginTest("nesting");
+
+        juce::ValueTree parent{ "Parent" };
+        juce::ValueTree child{ "Child" };
+        parent.appendChild(child, nullptr);
+
+        jive::Property<int> value{ child, "value" };
+        auto numChanges = 0;
+        value.onValueChange = [&numChanges] {
+            numChanges++;
+        };
+
+        {
+            const jive::PropertyTransaction outer{ parent };
+
+            {
+                const jive::PropertyTransaction inner{ child };
+                value = 1;
+            }
+
+            expectEquals(numChanges, 0);
+            value = 2;
+        }
+
+        expectEquals(numChanges, 1);
+    }
+
+    void testChangesWhileCompleting()
+    {
+        beginTest("changes made while completing");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> width{ tree, "width" };
+        jive::Property<int> height{ tree, "height" };
+        jive::Property<int> area{ tree, "area" };
+        auto numAreaChanges = 0;
+
+        const auto updateArea = [&] {
+            area = width.get() * height.get();
+        };
+        width.onValueChange = updateArea;
+        height.onValueChange = updateArea;
+        area.onValueChange = [&numAreaChanges] {
+            numAreaChanges++;
+        };
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            width = 10;
+            height = 20;
+        }
+
+        expectEquals(area.get(), 200);
+        expectEquals(numAreaChanges, 1);
+    }
+
+    void testReactions()
+    {
+        beginTest("reactions");
+
+        juce::ValueTree tree{ "Tree" };
+        auto numReactions = 0;
+        const auto react = [&numReactions] {
+            numReactions++;
+        };
+        const auto key = &numReactions;
+
+        expect(!jive::PropertyTransaction::deferUntilComplete(tree, key, react));
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            expect(jive::PropertyTransaction::deferUntilComplete(tree, key, react));
+            expect(jive::PropertyTransaction::deferUntilComplete(tree, key, react));
+            expectEquals(numReactions, 0);
+        }
+
+        expectEquals(numReactions, 1);
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            expect(jive::PropertyTransaction::deferUntilComplete(tree, key, react));
+            jive::PropertyTransaction::cancel(key);
+        }
+
+        expectEquals(numReactions, 1);
+    }
+};
+
+static PropertyTransactionUnitTest propertyTransactionUnitTest;
+#endif
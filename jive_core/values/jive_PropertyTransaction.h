@@ -0,0 +1,93 @@
+#pragma once
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace jive
+{
+    class PropertyDispatcher;
+
+    /** Defers the notifications for property changes made to a ValueTree, or
+        any of its descendants, until the transaction goes out of scope.
+
+        When the transaction completes, each Property interested in a change
+        is notified once per changed tree and property, however many times
+        that property was set in the meantime. Changes made by those
+        notifications are coalesced in the same way before the transaction
+        ends. Reactions deferred with deferUntilComplete() are then called
+        once each, so setting several properties in a row triggers each
+        layout or style update only once.
+
+        Transactions can be nested, in which case changes are delivered when
+        the outermost transaction covering them completes. Only Properties'
+        notifications are deferred - other ValueTree listeners are still
+        notified immediately.
+
+        Unlike BoxModel::ScopedCallbackLock, which drops its callbacks,
+        nothing is lost: every interested Property is still told about the
+        change, just later.
+    */
+    class PropertyTransaction
+    {
+    public:
+        explicit PropertyTransaction(const juce::ValueTree& treeToBatch);
+        ~PropertyTransaction();
+
+        /** If a transaction covering the given tree is in progress, schedules
+            the callback to be called once when it completes and returns true.
+            Callbacks with the same key are only called once per transaction.
+
+            Otherwise returns false, and the caller should react immediately.
+        */
+        [[nodiscard]] static bool deferUntilComplete(const juce::ValueTree& tree,
+                                                     const void* key,
+                                                     std::function<void()> callback);
+
+        /** Cancels any callbacks deferred with the given key, e.g. because
+            the object they refer to is being destroyed.
+        */
+        static void cancel(const void* key);
+
+        /** Immediately delivers any pending changes to the properties of the
+            given tree, rather than waiting for the transaction to complete.
+        */
+        static void flush(const juce::ValueTree& tree);
+
+        [[nodiscard]] static bool isInProgressFor(const juce::ValueTree& tree);
+
+    private:
+        friend class PropertyDispatcher;
+
+        struct Change
+        {
+            std::weak_ptr<PropertyDispatcher> dispatcher;
+            juce::ValueTree tree;
+            juce::Identifier property;
+        };
+
+        struct Reaction
+        {
+            const void* key;
+            std::function<void()> callback;
+        };
+
+        [[nodiscard]] static PropertyTransaction* findTransactionCovering(const juce::ValueTree& tree);
+        [[nodiscard]] static bool defer(PropertyDispatcher& dispatcher,
+                                        const juce::ValueTree& treeWhosePropertyChanged,
+                                        const juce::Identifier& property);
+
+        void addChange(PropertyDispatcher& dispatcher,
+                       const juce::ValueTree& treeWhosePropertyChanged,
+                       const juce::Identifier& property);
+        void deliverChanges();
+
+        const juce::ValueTree tree;
+        std::vector<Change> changes;
+        std::unordered_multimap<std::size_t, std::size_t> changeIndices;
+        std::size_t numDeliveredChanges{ 0 };
+        std::vector<Reaction> reactions;
+        std::unordered_set<const void*> reactionKeys;
+        bool isCompleting{ false };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PropertyTransaction)
+    };
+} // namespace jive
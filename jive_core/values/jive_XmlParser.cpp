@@ -1,74 +1,513 @@
 #include "jive_XmlParser.h"
 
+#include "jive_BinaryView.h"
+
 namespace jive
 {
-    static juce::String accumulateInlineText(juce::XmlElement& xml)
+    static const juce::Identifier textType{ "Text" };
+    static const juce::Identifier textProperty{ "text" };
+
+    // Deeper documents are treated as malformed, rather than risking running
+    // out of stack while parsing them
+    static constexpr auto maxXmlDepth = 256;
+
+    static void setAttribute(juce::ValueTree& tree, const juce::Identifier& name, const juce::String& value)
     {
-        juce::String result;
+        // Same as juce::ValueTree::fromXml()
+        if (const auto nameString = name.toString(); nameString.startsWith("base64:"))
+        {
+            if (juce::MemoryBlock data; data.fromBase64Encoding(value))
+            {
+                tree.setProperty(nameString.substring(7), juce::var{ data }, nullptr);
+                return;
+            }
+        }
+
+        tree.setProperty(name, value, nullptr);
+    }
+
+    // Text elements take their inline text as their "text" property, anything
+    // else gets it as an extra Text child
+    static void applyInlineText(juce::ValueTree& tree, const juce::String& inlineText)
+    {
+        if (tree.hasType(textType))
+        {
+            if (const auto text = tree[textProperty].toString() + inlineText;
+                text.isNotEmpty())
+            {
+                tree.setProperty(textProperty, text, nullptr);
+            }
+        }
+        else if (inlineText.isNotEmpty())
+        {
+            tree.appendChild(juce::ValueTree{ textType, { { textProperty, inlineText } } }, nullptr);
+        }
+    }
+
+    [[nodiscard]] static juce::ValueTree createTree(const juce::XmlElement& xml)
+    {
+        juce::ValueTree tree{ xml.getTagName() };
+
+        for (auto i = 0; i < xml.getNumAttributes(); i++)
+            setAttribute(tree, xml.getAttributeName(i), xml.getAttributeValue(i));
+
+        juce::String inlineText;
 
         for (auto* child : xml.getChildIterator())
         {
             if (child->isTextElement())
-                result += child->getText();
+                inlineText += child->getText();
+            else
+                tree.appendChild(createTree(*child), nullptr);
         }
 
-        return result;
+        applyInlineText(tree, inlineText);
+        return tree;
     }
 
-    static void replaceInlineTextWithProperty(juce::XmlElement& xml)
+    /** Builds a ValueTree from UTF-8 XML in a single pass over the source,
+        without building an XmlElement first.
+
+        Accepts the same documents as juce::XmlDocument: prologs, comments,
+        processing instructions and DOCTYPEs are skipped, the predefined and
+        numeric entities are expanded, whitespace-only text is ignored and
+        CDATA sections are kept as text.
+    */
+    class StreamingXmlParser
     {
-        const auto text = xml.getStringAttribute("text", "")
-                        + accumulateInlineText(xml);
+    public:
+        StreamingXmlParser(const char* sourceStart, const char* sourceEnd)
+            : position{ sourceStart }
+            , end{ findEnd(sourceStart, sourceEnd) }
+        {
+        }
 
-        if (text.isNotEmpty())
-            xml.setAttribute("text", text);
+        [[nodiscard]] juce::ValueTree parse()
+        {
+            skipMisc();
 
-        xml.deleteAllTextElements();
-    }
+            if (failed || peek() != '<')
+                return {};
 
-    static void replaceInlineTextWithTextElement(juce::XmlElement& xml)
-    {
-        if (const auto text = accumulateInlineText(xml);
-            text.isNotEmpty())
+            auto view = parseElement(0);
+
+            if (failed)
+                return {};
+
+            return view;
+        }
+
+    private:
+        [[nodiscard]] static const char* findEnd(const char* start, const char* end)
         {
-            auto textElement = std::make_unique<juce::XmlElement>("Text");
-            textElement->setAttribute("text", text);
-            xml.addChildElement(textElement.release());
+            // Anything after a null terminator is ignored, as it is when the
+            // data is converted to a juce::String
+            if (const auto* terminator = static_cast<const char*>(std::memchr(start, 0, static_cast<std::size_t>(end - start))))
+                return terminator;
+
+            return end;
         }
 
-        xml.deleteAllTextElements();
-    }
+        [[nodiscard]] static bool isWhitespace(char character) noexcept
+        {
+            return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+        }
 
-    static void replaceInlineTextRecursive(juce::XmlElement& xml)
-    {
-        if (xml.getTagName() == "Text")
-            replaceInlineTextWithProperty(xml);
-        else
-            replaceInlineTextWithTextElement(xml);
+        [[nodiscard]] static bool isNameCharacter(char character) noexcept
+        {
+            const auto byte = static_cast<unsigned char>(character);
 
-        for (auto* child : xml.getChildIterator())
-            replaceInlineTextRecursive(*child);
-    }
+            return byte >= 0x80
+                || juce::CharacterFunctions::isLetterOrDigit(static_cast<juce::juce_wchar>(byte))
+                || character == '_'
+                || character == '-'
+                || character == ':'
+                || character == '.';
+        }
 
-    [[nodiscard]] juce::ValueTree parseXML(const juce::XmlElement& sourceXML)
-    {
-        auto xml = sourceXML;
-        replaceInlineTextRecursive(xml);
+        [[nodiscard]] char peek() const noexcept
+        {
+            return position < end ? *position : '\0';
+        }
+
+        [[nodiscard]] bool startsWith(std::string_view text) const noexcept
+        {
+            return static_cast<std::size_t>(end - position) >= std::size(text)
+                && std::equal(std::begin(text), std::end(text), position);
+        }
+
+        void skipWhitespace() noexcept
+        {
+            while (position < end && isWhitespace(*position))
+                ++position;
+        }
+
+        void skipPast(std::string_view terminator) noexcept
+        {
+            for (; position < end; ++position)
+            {
+                if (startsWith(terminator))
+                {
+                    position += std::size(terminator);
+                    return;
+                }
+            }
+
+            failed = true;
+        }
+
+        void skipDoctype() noexcept
+        {
+            auto depth = 0;
+
+            for (; position < end; ++position)
+            {
+                if (*position == '[')
+                {
+                    depth++;
+                }
+                else if (*position == ']')
+                {
+                    depth--;
+                }
+                else if (*position == '>' && depth <= 0)
+                {
+                    ++position;
+                    return;
+                }
+            }
+
+            failed = true;
+        }
+
+        void skipMisc() noexcept
+        {
+            while (!failed)
+            {
+                skipWhitespace();
+
+                if (startsWith("<!--"))
+                    skipPast("-->");
+                else if (startsWith("<?"))
+                    skipPast("?>");
+                else if (startsWith("<!DOCTYPE"))
+                    skipDoctype();
+                else
+                    return;
+            }
+        }
+
+        [[nodiscard]] juce::Identifier readName()
+        {
+            const auto* const start = position;
+
+            while (position < end && isNameCharacter(*position))
+                ++position;
+
+            if (position == start)
+            {
+                failed = true;
+                return {};
+            }
+
+            return juce::Identifier{
+                juce::CharPointer_UTF8{ start },
+                juce::CharPointer_UTF8{ position },
+            };
+        }
+
+        void appendEntity(std::string& text)
+        {
+            static constexpr std::ptrdiff_t maxEntityLength = 12;
+            const auto* const semicolon = static_cast<const char*>(std::memchr(position,
+                                                                               ';',
+                                                                               static_cast<std::size_t>(juce::jmin(maxEntityLength, end - position))));
+
+            if (semicolon == nullptr)
+            {
+                text += *position++;
+                return;
+            }
+
+            const std::string_view entity{ position + 1, static_cast<std::size_t>(semicolon - position - 1) };
+            const auto* const entityEnd = semicolon + 1;
+
+            if (entity == "amp")
+                text += '&';
+            else if (entity == "lt")
+                text += '<';
+            else if (entity == "gt")
+                text += '>';
+            else if (entity == "quot")
+                text += '"';
+            else if (entity == "apos")
+                text += '\'';
+            else if (const auto character = parseCharacterReference(entity); character > 0)
+                appendUTF8(text, character);
+            else
+                text.append(position, entityEnd);
+
+            position = entityEnd;
+        }
+
+        [[nodiscard]] static juce::juce_wchar parseCharacterReference(std::string_view entity) noexcept
+        {
+            if (std::size(entity) < 2 || entity[0] != '#')
+                return 0;
+
+            const auto isHex = entity[1] == 'x' || entity[1] == 'X';
+            const auto digits = entity.substr(isHex ? 2 : 1);
+            juce::uint32 result = 0;
+
+            if (digits.empty())
+                return 0;
+
+            for (const auto digit : digits)
+            {
+                const auto value = isHex ? juce::CharacterFunctions::getHexDigitValue(static_cast<juce::juce_wchar>(digit))
+                                         : (juce::CharacterFunctions::isDigit(digit) ? digit - '0' : -1);
+
+                if (value < 0)
+                    return 0;
+
+                result = result * (isHex ? 16u : 10u) + static_cast<juce::uint32>(value);
+
+                if (result > 0x10ffff)
+                    return 0;
+            }
+
+            return static_cast<juce::juce_wchar>(result);
+        }
+
+        static void appendUTF8(std::string& text, juce::juce_wchar character)
+        {
+            char buffer[8]{};
+            juce::CharPointer_UTF8 destination{ buffer };
+            destination.write(character);
+            text.append(buffer, destination.getAddress());
+        }
+
+        [[nodiscard]] juce::String readAttributeValue(char quote)
+        {
+            const auto* const start = position;
+
+            while (position < end && *position != quote && *position != '&')
+                ++position;
+
+            if (position < end && *position == quote)
+                return juce::String::fromUTF8(start, static_cast<int>(position++ - start));
+
+            buffer.assign(start, position);
+
+            while (position < end && *position != quote)
+            {
+                if (*position == '&')
+                    appendEntity(buffer);
+                else
+                    buffer += *position++;
+            }
+
+            if (position >= end)
+            {
+                failed = true;
+                return {};
+            }
+
+            ++position;
+            return juce::String::fromUTF8(buffer.data(), static_cast<int>(std::size(buffer)));
+        }
+
+        // Returns false if the tag was self-closing
+        [[nodiscard]] bool parseAttributes(juce::ValueTree& tree)
+        {
+            while (!failed)
+            {
+                skipWhitespace();
+
+                if (startsWith("/>"))
+                {
+                    position += 2;
+                    return false;
+                }
+
+                if (peek() == '>')
+                {
+                    ++position;
+                    return true;
+                }
+
+                const auto name = readName();
+                skipWhitespace();
+
+                if (failed || peek() != '=')
+                    break;
+
+                ++position;
+                skipWhitespace();
+
+                if (const auto quote = peek(); quote == '"' || quote == '\'')
+                {
+                    ++position;
+                    const auto value = readAttributeValue(quote);
+
+                    if (!failed)
+                        setAttribute(tree, name, value);
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            failed = true;
+            return false;
+        }
+
+        // Text that's only whitespace is ignored, and comments within text
+        // are skipped, as they are by juce::XmlDocument
+        void readText(std::string& inlineText)
+        {
+            const auto previousSize = std::size(inlineText);
+            auto hasContent = false;
+
+            while (position < end && !failed)
+            {
+                if (*position == '<')
+                {
+                    if (!startsWith("<!--"))
+                        break;
+
+                    skipPast("-->");
+                }
+                else if (*position == '&')
+                {
+                    appendEntity(inlineText);
+                    hasContent = true;
+                }
+                else
+                {
+                    hasContent = hasContent || !isWhitespace(*position);
+                    inlineText += *position++;
+                }
+            }
+
+            if (!hasContent)
+                inlineText.resize(previousSize);
+        }
+
+        [[nodiscard]] juce::ValueTree parseElement(int depth)
+        {
+            if (depth > maxXmlDepth)
+            {
+                failed = true;
+                return {};
+            }
+
+            ++position;
+            const auto type = readName();
+
+            if (failed)
+                return {};
+
+            juce::ValueTree tree{ type };
+
+            if (!parseAttributes(tree))
+                return failed ? juce::ValueTree{} : tree;
+
+            std::string inlineText;
+
+            while (!failed)
+            {
+                if (position >= end)
+                {
+                    failed = true;
+                    break;
+                }
+
+                if (*position != '<')
+                {
+                    readText(inlineText);
+                }
+                else if (startsWith("</"))
+                {
+                    // Like juce::XmlDocument, the closing tag's name isn't
+                    // checked
+                    skipPast(">");
+                    break;
+                }
+                else if (startsWith("<!--"))
+                {
+                    skipPast("-->");
+                }
+                else if (startsWith("<![CDATA["))
+                {
+                    position += 9;
+                    const auto* const start = position;
+                    skipPast("]]>");
+
+                    if (!failed)
+                        inlineText.append(start, position - 3);
+                }
+                else if (startsWith("<?"))
+                {
+                    skipPast("?>");
+                }
+                else
+                {
+                    auto child = parseElement(depth + 1);
+
+                    if (!failed)
+                        tree.appendChild(child, nullptr);
+                }
+            }
 
-        return juce::ValueTree::fromXml(xml);
+            if (failed)
+                return {};
+
+            applyInlineText(tree, juce::String::fromUTF8(inlineText.data(), static_cast<int>(std::size(inlineText))));
+            return tree;
+        }
+
+        const char* position;
+        const char* const end;
+        std::string buffer;
+        bool failed{ false };
+    };
+
+    [[nodiscard]] juce::ValueTree parseXML(const juce::XmlElement& xml)
+    {
+        return createTree(xml);
     }
 
     [[nodiscard]] juce::ValueTree parseXML(const juce::String& xmlString)
     {
-        if (auto xml = juce::parseXML(xmlString))
-            return parseXML(*xml);
-
-        return {};
+        const auto* const data = xmlString.toRawUTF8();
+        return StreamingXmlParser{ data, data + xmlString.getNumBytesAsUTF8() }.parse();
     }
 
     [[nodiscard]] juce::ValueTree parseXML(const void* xmlStringData, int xmlStringDataSize)
     {
-        return jive::parseXML(juce::String::createStringFromData(xmlStringData, xmlStringDataSize));
+        const auto size = static_cast<std::size_t>(juce::jmax(0, xmlStringDataSize));
+
+        // Views compiled ahead of time can be embedded in place of their XML
+        if (isBinaryView(xmlStringData, size))
+            return loadBinaryView(xmlStringData, size);
+
+        if (xmlStringData == nullptr || size < 2)
+            return {};
+
+        const auto* const bytes = static_cast<const juce::uint8*>(xmlStringData);
+
+        if ((bytes[0] == 0xff && bytes[1] == 0xfe) || (bytes[0] == 0xfe && bytes[1] == 0xff))
+            return jive::parseXML(juce::String::createStringFromData(xmlStringData, xmlStringDataSize));
+
+        const auto* start = static_cast<const char*>(xmlStringData);
+        const auto* const end = start + size;
+
+        if (size >= 3 && bytes[0] == 0xef && bytes[1] == 0xbb && bytes[2] == 0xbf)
+            start += 3;
+
+        return StreamingXmlParser{ start, end }.parse();
     }
 } // namespace jive
 
@@ -88,6 +527,11 @@ public:
         testParsingXmlElement();
         testTextElementWithInlineText();
         testNonTextElementWithInlineText();
+        testMarkup();
+        testMatchesXmlElementParsing();
+        testMalformedXml();
+        testByteOrderMark();
+        testDeepDocuments();
     }
 
 private:
@@ -172,6 +616,97 @@ private:
                          juce::String{ "Click me!" });
         }
     }
+
+    void testMarkup()
+    {
+        beginTest("markup");
+
+        static constexpr auto source = R"(<?xml version="1.0" encoding="UTF-8"?>
+            <!DOCTYPE View [ <!ELEMENT View ANY> ]>
+            <!-- A comment before the view -->
+            <View title="Fish &amp; Chips" quote='"' code="&#65;&#x42;">
+                <!-- A comment inside the view -->
+                <Text>1 &lt; 2</Text>
+                <Text><![CDATA[<b>bold</b>]]></Text>
+                <Button>Click <Image/> me</Button>
+            </View>
+        )";
+        const auto result = jive::parseXML(source);
+        expect(result.isValid());
+        expectEquals(result["title"].toString(), juce::String{ "Fish & Chips" });
+        expectEquals(result["quote"].toString(), juce::String{ "\"" });
+        expectEquals(result["code"].toString(), juce::String{ "AB" });
+        expectEquals(result.getNumChildren(), 3);
+        expectEquals(result.getChild(0)["text"].toString(), juce::String{ "1 < 2" });
+        expectEquals(result.getChild(1)["text"].toString(), juce::String{ "<b>bold</b>" });
+
+        const auto button = result.getChild(2);
+        expectEquals(button.getNumChildren(), 2);
+        expectEquals(button.getChild(0).getType().toString(), juce::String{ "Image" });
+        expectEquals(button.getChild(1)["text"].toString(), juce::String{ "Click  me" });
+    }
+
+    void testMatchesXmlElementParsing()
+    {
+        beginTest("matches XmlElement parsing");
+
+        static constexpr auto source = R"(
+            <Window width="640" height="400" base64:data="SGVsbG8=">
+                <Text text="Hello, ">World</Text>
+                <Component display="flex">
+                    Some inline text
+                    <Button id="ok">OK</Button>
+                    more text
+                </Component>
+                <Text text="Attribute only"/>
+            </Window>
+        )";
+        const auto xml = juce::parseXML(source);
+        expect(xml != nullptr);
+
+        const auto streamed = jive::parseXML(source);
+        expect(streamed.isEquivalentTo(jive::parseXML(*xml)));
+        expectEquals(streamed.getChild(0)["text"].toString(), juce::String{ "Hello, World" });
+        expect(streamed["data"].isBinaryData());
+    }
+
+    void testMalformedXml()
+    {
+        beginTest("malformed XML");
+
+        expect(!jive::parseXML("").isValid());
+        expect(!jive::parseXML("Not XML").isValid());
+        expect(!jive::parseXML("<View>").isValid());
+        expect(!jive::parseXML("<View x=\"1/>").isValid());
+        expect(!jive::parseXML("<View x=1/>").isValid());
+        expect(!jive::parseXML("<View><!-- </View>").isValid());
+    }
+
+    void testByteOrderMark()
+    {
+        beginTest("byte order mark");
+
+        static constexpr char source[] = "\xef\xbb\xbf<View x=\"1\"/>";
+        const auto result = jive::parseXML(source, static_cast<int>(sizeof(source)));
+        expectEquals(result.getType().toString(), juce::String{ "View" });
+        expectEquals(static_cast<int>(result["x"]), 1);
+    }
+
+    void testDeepDocuments()
+    {
+        beginTest("deep documents");
+
+        const auto createSource = [](int depth) {
+            return juce::String::repeatedString("<Component>", depth + 1)
+                 + juce::String::repeatedString("</Component>", depth + 1);
+        };
+
+        const auto shallow = jive::parseXML(createSource(100));
+        expect(shallow.isValid());
+        expectEquals(shallow.getChild(0).getNumChildren(), 1);
+
+        expect(!jive::parseXML(createSource(100000)).isValid());
+    }
 };
 
 static XmlParserUnitTest xmlParserUnitTest;
@@ -6,5 +6,9 @@ namespace jive
 {
     [[nodiscard]] juce::ValueTree parseXML(const juce::XmlElement& xml);
     [[nodiscard]] juce::ValueTree parseXML(const juce::String& xmlString);
+
+    /** Parses the given XML data, or loads it directly if it's a view compiled
+        with compileBinaryView(), e.g. by the view compiler runner.
+    */
     [[nodiscard]] juce::ValueTree parseXML(const void* xmlStringData, int xmlStringDataSize);
 } // namespace jive
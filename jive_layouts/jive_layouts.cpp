@@ -3,12 +3,15 @@
 #include "utilities/jive_ComponentFactory.cpp"
 #include "utilities/jive_Display.cpp"
 #include "utilities/jive_Drawable.cpp"
+#include "utilities/jive_DrawableStore.cpp"
 #include "utilities/jive_Overflow.cpp"
+#include "utilities/jive_SvgCache.cpp"
 
 #include "hooks/jive_View.cpp"
 
 #include "layout/gui-items/jive_GuiItem.cpp"
 #include "layout/gui-items/jive_GuiItemDecorator.cpp"
+#include "layout/gui-items/jive_PerformanceReport.cpp"
 
 #include "layout/gui-items/jive_CommonGuiItem.cpp"
 #include "layout/gui-items/jive_ContainerItem.cpp"
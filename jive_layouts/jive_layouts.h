@@ -35,13 +35,16 @@ namespace jive
 #include "utilities/jive_ComponentFactory.h"
 #include "utilities/jive_Display.h"
 #include "utilities/jive_Drawable.h"
+#include "utilities/jive_DrawableStore.h"
 #include "utilities/jive_LayoutStrategy.h"
 #include "utilities/jive_Overflow.h"
+#include "utilities/jive_SvgCache.h"
 
 #include "hooks/jive_View.h"
 
 #include "layout/gui-items/jive_GuiItem.h"
 #include "layout/gui-items/jive_GuiItemDecorator.h"
+#include "layout/gui-items/jive_PerformanceReport.h"
 
 #include "layout/gui-items/jive_CommonGuiItem.h"
 #include "layout/gui-items/jive_ContainerItem.h"
@@ -15,6 +15,8 @@ namespace jive
 
     void BlockContainer::layOutChildren()
     {
+        JIVE_PROFILE_TREE_SCOPE("BlockContainer::layOutChildren", state);
+
         GuiItemDecorator::layOutChildren();
 
         for (auto child : getChildren())
@@ -24,32 +24,32 @@ namespace jive
             centreX.clear();
             updateBounds();
         };
-        x.onTransitionProgressed = updateBounds;
+        x.onTransitionProgressed = countingTransitionTicks(updateBounds);
 
         y.onValueChange = [this, updateBounds]() {
             centreY.clear();
             updateBounds();
         };
-        y.onTransitionProgressed = updateBounds;
+        y.onTransitionProgressed = countingTransitionTicks(updateBounds);
 
         centreX.onValueChange = [this, updateBounds]() {
             x.clear();
             updateBounds();
         };
-        centreX.onTransitionProgressed = updateBounds;
+        centreX.onTransitionProgressed = countingTransitionTicks(updateBounds);
 
         centreY.onValueChange = [this, updateBounds]() {
             y.clear();
             updateBounds();
         };
-        centreY.onTransitionProgressed = updateBounds;
+        centreY.onTransitionProgressed = countingTransitionTicks(updateBounds);
 
-        width.onTransitionProgressed = [this] {
+        width.onTransitionProgressed = countingTransitionTicks([this] {
             getComponent()->setBounds(calculateBounds());
-        };
-        height.onTransitionProgressed = [this] {
+        });
+        height.onTransitionProgressed = countingTransitionTicks([this] {
             getComponent()->setBounds(calculateBounds());
-        };
+        });
 
         updateBounds();
     }
@@ -29,11 +29,13 @@ namespace jive
 
         setChildComponent(createChildComponent());
         boxModel.addListener(*this);
+        JIVE_INSTRUMENT(valueTreeListenersAdded, 1);
         state.addListener(this);
     }
 
     Image::~Image()
     {
+        JIVE_INSTRUMENT(valueTreeListenersRemoved, 1);
         state.removeListener(this);
         boxModel.removeListener(*this);
 
@@ -53,9 +55,7 @@ namespace jive
 
     Drawable Image::getDrawable() const
     {
-        const auto isInlineSVG = state.getType().toString().compareIgnoreCase("svg") == 0;
-
-        if (isInlineSVG)
+        if (isInlineSVG())
             return Drawable{ state.toXmlString() };
 
         return source.get();
@@ -90,23 +90,104 @@ namespace jive
         idealHeight = juce::String{ calculateRequiredHeight() };
     }
 
-    void Image::valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&)
+    void Image::valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& id)
     {
-        if (state.getType().toString().compareIgnoreCase("svg") == 0)
+        if (!isInlineSVG() || changingChild || childComponent == nullptr)
+            return;
+
+        if (id == idealWidth.id || id == idealHeight.id)
+            return;
+
+        if (static const juce::Identifier fillProperty{ "fill" };
+            tree == state && id == fillProperty && updateInlineSVGFill())
+            return;
+
+        setChildComponent(createChildComponent());
+
+        childComponent->setBounds(getComponent()->getLocalBounds());
+
+        if (auto* drawable = dynamic_cast<juce::Drawable*>(childComponent.get()))
         {
-            if (!changingChild && childComponent != nullptr)
-            {
-                setChildComponent(createChildComponent());
+            drawable->setTransformToFit(getComponent()->getLocalBounds().toFloat(),
+                                        placement.get());
+        }
+    }
 
-                childComponent->setBounds(getComponent()->getLocalBounds());
+    bool Image::isInlineSVG(const juce::Identifier& type)
+    {
+        // Compares the pooled name in place rather than copying it
+        return type.getCharPointer().compareIgnoreCase(juce::CharPointer_ASCII{ "svg" }) == 0;
+    }
 
-                if (auto* drawable = dynamic_cast<juce::Drawable*>(childComponent.get()))
-                {
-                    drawable->setTransformToFit(getComponent()->getLocalBounds().toFloat(),
-                                                placement.get());
-                }
+    bool Image::isInlineSVG() const
+    {
+        return isInlineSVG(state.getType());
+    }
+
+    [[nodiscard]] static std::optional<juce::Colour> parseInlineSVGFill(const juce::var& fill)
+    {
+        if (fill.isVoid())
+            return juce::Colours::black;
+
+        const auto text = fill.toString().trim();
+
+        if (text.startsWith("#") || text.startsWith("rgb") || text.startsWith("hsl"))
+            return parseColour(text);
+
+        return std::nullopt;
+    }
+
+    // Inline SVGs are built with this as their root fill, so that the shapes
+    // that inherit the root fill can be told apart from the ones that set
+    // their own
+    static const juce::Colour inheritedFillMarker{ 0xFF010203 };
+
+    void Image::collectInheritedFills(juce::Component& component,
+                                      std::vector<InheritedFill>& inheritedFills)
+    {
+        if (auto* shape = dynamic_cast<juce::DrawableShape*>(&component))
+        {
+            if (const auto& fill = shape->getFill();
+                fill.isColour() && fill.colour.withAlpha(1.0f) == inheritedFillMarker)
+            {
+                inheritedFills.push_back({ shape, fill.colour.getFloatAlpha() });
             }
         }
+
+        for (auto* child : component.getChildren())
+            collectInheritedFills(*child, inheritedFills);
+    }
+
+    void Image::trackInheritedFill()
+    {
+        inheritedFills.clear();
+        inlineSVGFill = parseInlineSVGFill(state["fill"]);
+
+        if (!inlineSVGFill.has_value())
+            return;
+
+        collectInheritedFills(*childComponent, inheritedFills);
+
+        for (const auto& [shape, opacity] : inheritedFills)
+            shape->setFill(inlineSVGFill->withMultipliedAlpha(opacity));
+    }
+
+    bool Image::updateInlineSVGFill()
+    {
+        const auto newFill = parseInlineSVGFill(state["fill"]);
+
+        if (!inlineSVGFill.has_value()
+            || !newFill.has_value()
+            || dynamic_cast<juce::Drawable*>(childComponent.get()) == nullptr)
+        {
+            return false;
+        }
+
+        for (const auto& [shape, opacity] : inheritedFills)
+            shape->setFill(newFill->withMultipliedAlpha(opacity));
+
+        inlineSVGFill = newFill;
+        return true;
     }
 
     float Image::calculateAspectRatio(const juce::ImageComponent& image) const
@@ -184,21 +265,23 @@ namespace jive
         return imageComponent;
     }
 
-    std::unique_ptr<juce::Drawable> Image::createSVG(const juce::String& svgString) const
-    {
-        const auto xml = juce::parseXML(svgString);
-        return juce::Drawable::createFromSVG(*xml);
-    }
-
     std::unique_ptr<juce::Component> Image::createChildComponent() const
     {
+        if (isInlineSVG() && parseInlineSVGFill(state["fill"]).has_value())
+        {
+            auto svg = state.createXml();
+            svg->setAttribute("fill", "#" + inheritedFillMarker.toDisplayString(false));
+
+            return Drawable{ *svg }.createCopy();
+        }
+
         const auto drawable = getDrawable();
 
         if (drawable.isImage())
             return createImageComponent(drawable);
 
         if (drawable.isSVG())
-            return createSVG(drawable);
+            return drawable.createCopy();
 
         return nullptr;
     }
@@ -207,6 +290,8 @@ namespace jive
     {
         const juce::ScopedValueSetter svs{ changingChild, true };
 
+        inheritedFills.clear();
+
         if (newComponent == nullptr)
         {
             childComponent = nullptr;
@@ -216,6 +301,9 @@ namespace jive
         childComponent.reset();
         childComponent = std::move(newComponent);
 
+        if (isInlineSVG())
+            trackInheritedFill();
+
         getComponent()->addAndMakeVisible(*childComponent);
         childComponent->setBounds(getComponent()->getLocalBounds());
 
@@ -245,6 +333,8 @@ public:
         testChildComponent();
         testSVG();
         testInlineSVG();
+        testInlineSVGFill();
+        testInlineSVGExplicitFills();
     }
 
 private:
@@ -545,6 +635,108 @@ private:
                            ->toType<jive::Image>();
         expect(image.getDrawable().isSVG());
     }
+
+    [[nodiscard]] static const juce::DrawableShape* findShape(const juce::Component& component)
+    {
+        if (const auto* shape = dynamic_cast<const juce::DrawableShape*>(&component))
+            return shape;
+
+        for (const auto* child : component.getChildren())
+        {
+            if (const auto* shape = findShape(*child))
+                return shape;
+        }
+
+        return nullptr;
+    }
+
+    void testInlineSVGFill()
+    {
+        beginTest("inline SVG / fill");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 200 },
+            },
+            {
+                juce::ValueTree::fromXml(R"(
+                    <svg width="10" height="10">
+                        <rect width="10" height="10"/>
+                    </svg>
+                )"),
+            },
+        };
+        jive::Interpreter interpreter;
+        auto parent = interpreter.interpret(state);
+        auto& image = *dynamic_cast<jive::GuiItemDecorator*>(parent->getChildren()[0])
+                           ->toType<jive::Image>();
+        const auto* drawable = image.getComponent()->getChildComponent(0);
+        expect(findShape(*drawable) != nullptr);
+        expect(findShape(*drawable)->getFill().colour == juce::Colours::black);
+
+        state.getChild(0).setProperty("fill", "#00FF00", nullptr);
+        expect(image.getComponent()->getChildComponent(0) == drawable);
+        expect(findShape(*drawable)->getFill().colour == juce::Colour{ 0xFF00FF00 });
+
+        state.getChild(0).setProperty("fill", "none", nullptr);
+        expect(image.getComponent()->getChildComponent(0) != drawable);
+    }
+
+    [[nodiscard]] static std::vector<const juce::DrawableShape*> findShapes(const juce::Component& component)
+    {
+        std::vector<const juce::DrawableShape*> shapes;
+
+        if (const auto* shape = dynamic_cast<const juce::DrawableShape*>(&component))
+            shapes.push_back(shape);
+
+        for (const auto* child : component.getChildren())
+        {
+            const auto childShapes = findShapes(*child);
+            shapes.insert(std::end(shapes), std::begin(childShapes), std::end(childShapes));
+        }
+
+        return shapes;
+    }
+
+    void testInlineSVGExplicitFills()
+    {
+        beginTest("inline SVG / explicit fills");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 200 },
+            },
+            {
+                juce::ValueTree::fromXml(R"(
+                    <svg width="10" height="10" fill="#FF0000">
+                        <rect width="10" height="5"/>
+                        <rect y="5" width="10" height="5" fill="#FF0000"/>
+                    </svg>
+                )"),
+            },
+        };
+        jive::Interpreter interpreter;
+        auto parent = interpreter.interpret(state);
+        auto& image = *dynamic_cast<jive::GuiItemDecorator*>(parent->getChildren()[0])
+                           ->toType<jive::Image>();
+        const auto* drawable = image.getComponent()->getChildComponent(0);
+        auto shapes = findShapes(*drawable);
+        expectEquals(static_cast<int>(std::size(shapes)), 2);
+        expect(shapes[0]->getFill().colour == juce::Colour{ 0xFFFF0000 });
+        expect(shapes[1]->getFill().colour == juce::Colour{ 0xFFFF0000 });
+
+        // Only the shape that inherits the root fill follows it, even though
+        // the other shape's own fill is the same colour
+        state.getChild(0).setProperty("fill", "#0000FF", nullptr);
+        expect(image.getComponent()->getChildComponent(0) == drawable);
+        shapes = findShapes(*drawable);
+        expect(shapes[0]->getFill().colour == juce::Colour{ 0xFF0000FF });
+        expect(shapes[1]->getFill().colour == juce::Colour{ 0xFFFF0000 });
+    }
 };
 
 static ImageTest imageTest;
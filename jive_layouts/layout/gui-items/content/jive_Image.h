@@ -20,12 +20,30 @@ namespace jive
 
         Drawable getDrawable() const;
 
+        /** Returns true for the "svg" type, in any case, whose children are
+            inline SVG rather than items.
+        */
+        [[nodiscard]] static bool isInlineSVG(const juce::Identifier& type);
+
     protected:
         void componentMovedOrResized(juce::Component&, bool, bool) override;
         void boxModelChanged(BoxModel& boxModelThatChanged) override;
         void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier& id) override;
 
     private:
+        struct InheritedFill
+        {
+            juce::DrawableShape* shape;
+            float opacity;
+        };
+
+        static void collectInheritedFills(juce::Component& component,
+                                          std::vector<InheritedFill>& inheritedFills);
+
+        bool isInlineSVG() const;
+        void trackInheritedFill();
+        bool updateInlineSVGFill();
+
         float calculateAspectRatio(const juce::ImageComponent& image) const;
         float calculateRequiredWidth(const juce::ImageComponent& image) const;
         float calculateRequiredWidth(const juce::Drawable& drawable) const;
@@ -35,12 +53,13 @@ namespace jive
         float calculateRequiredHeight() const;
 
         std::unique_ptr<juce::ImageComponent> createImageComponent(const juce::Image& image) const;
-        std::unique_ptr<juce::Drawable> createSVG(const juce::String& svgString) const;
         std::unique_ptr<juce::Component> createChildComponent() const;
         void setChildComponent(std::unique_ptr<juce::Component> newComponent);
 
         std::unique_ptr<juce::Component> childComponent;
         bool changingChild = false;
+        std::optional<juce::Colour> inlineSVGFill;
+        std::vector<InheritedFill> inheritedFills;
 
         Property<Drawable> source;
         Property<juce::RectanglePlacement> placement;
@@ -42,8 +42,8 @@ namespace jive
 
         state.setProperty("ideal-height",
                           juce::var{ [this](const juce::var::NativeFunctionArgs& args) {
-                              const auto layout = buildTextLayout(args.arguments[0]);
-                              return std::ceil(layout.getHeight());
+                              const auto width = getAvailableWidth(args.arguments[0]);
+                              return std::ceil(getTextMetrics().getHeightForWidth(width));
                           } },
                           nullptr);
 
@@ -93,7 +93,75 @@ namespace jive
         updateTextComponent();
     }
 
-    juce::TextLayout Text::buildTextLayout(float maxWidth) const
+    void Text::attributedStringChanged(TextComponent&)
+    {
+        if (!updatingTextComponent)
+            textContentChanged();
+    }
+
+    void Text::attributedStringRecoloured(TextComponent&)
+    {
+        // Recolouring never changes the size of the text, so only the span
+        // in a parent text needs updating
+        if (updatingTextComponent)
+            return;
+
+        if (auto* parentItem = getParent())
+        {
+            if (auto* parentText = dynamic_cast<GuiItemDecorator&>(*parentItem).getTopLevelDecorator().toType<Text>())
+                parentText->nestedTextChanged(*this);
+        }
+    }
+
+    juce::Range<int> Text::getNestedTextRange(const Text& nestedText) const
+    {
+        const auto index = getNestedTextIndex(nestedText);
+
+        if (index < 0 || index >= getTextComponent().getNumAppendices())
+            return {};
+
+        return getTextComponent().getAppendixRange(index);
+    }
+
+    int Text::getNestedTextIndex(const Text& nestedText) const
+    {
+        auto index = 0;
+
+        for (const auto* child : getChildren())
+        {
+            const auto* text = dynamic_cast<const GuiItemDecorator*>(child)->toType<const Text>();
+
+            if (text == &nestedText)
+                return index;
+
+            if (text != nullptr)
+                index++;
+        }
+
+        return -1;
+    }
+
+    void Text::nestedTextChanged(const Text& nestedText)
+    {
+        const auto index = getNestedTextIndex(nestedText);
+
+        if (index < 0 || index >= getTextComponent().getNumAppendices())
+            return;
+
+        getTextComponent().setAppendix(index, nestedText.getTextComponent().getAttributedString());
+    }
+
+    float Text::getMinContentWidth() const
+    {
+        return getTextMetrics().getMinContentWidth();
+    }
+
+    float Text::getMaxContentWidth() const
+    {
+        return getTextMetrics().getMaxContentWidth();
+    }
+
+    float Text::getAvailableWidth(float maxWidth) const
     {
         for (auto* parentItem = getParent();
              maxWidth < 0.0f && parentItem != nullptr;
@@ -106,10 +174,21 @@ namespace jive
             }
         }
 
-        juce::TextLayout layout;
-        layout.createLayout(getTextComponent().getAttributedString(), maxWidth);
+        return maxWidth;
+    }
+
+    TextMetrics& Text::getTextMetrics() const
+    {
+        const auto& textComponent = getTextComponent();
 
-        return layout;
+        if (metrics == nullptr || metricsVersion != textComponent.getVersion())
+        {
+            metrics = std::make_unique<TextMetrics>(textComponent.getAttributedString(),
+                                                    textComponent.getLayoutHash());
+            metricsVersion = textComponent.getVersion();
+        }
+
+        return *metrics;
     }
 
     template <typename T>
@@ -126,22 +205,41 @@ namespace jive
 
     void Text::updateTextComponent()
     {
-        getTextComponent().setDirection(direction);
-        getTextComponent().setJustification(justification);
-        getTextComponent().setLineSpacing(lineSpacing);
-        getTextComponent().setText(text);
-        getTextComponent().setWordWrap(wordWrap);
-        getTextComponent().clearAttributes();
+        JIVE_PROFILE_TREE_SCOPE("Text::updateTextComponent", state);
+
+        const auto previousVersion = getTextComponent().getVersion();
+
+        {
+            const juce::ScopedValueSetter svs{ updatingTextComponent, true };
+
+            getTextComponent().setDirection(direction);
+            getTextComponent().setJustification(justification);
+            getTextComponent().setLineSpacing(lineSpacing);
+            getTextComponent().setText(text);
+            getTextComponent().setWordWrap(wordWrap);
+            updateNestedTexts();
+        }
+
+        if (auto* parentItem = getParent())
+        {
+            if (!parentItem->isContainer())
+                getTextComponent().setAccessible(false);
+        }
+
+        if (getTextComponent().getVersion() != previousVersion || !idealWidth.exists())
+            textContentChanged();
+    }
+
+    void Text::updateNestedTexts()
+    {
+        std::vector<const Text*> nestedTexts;
 
         for (auto* child : getChildren())
         {
             if (const auto* nestedText = dynamic_cast<const GuiItemDecorator*>(child)
                                              ->toType<const Text>())
             {
-                getTextComponent()
-                    .append(nestedText
-                                ->getTextComponent()
-                                .getAttributedString());
+                nestedTexts.push_back(nestedText);
             }
             else
             {
@@ -149,15 +247,35 @@ namespace jive
             }
         }
 
-        idealWidth = nextWholeNumberAbove(buildTextLayout(static_cast<float>(std::numeric_limits<juce::uint16>::max()))
-                                              .getWidth());
+        auto& textComponent = getTextComponent();
+
+        // Only replace the spans of nested texts that actually changed,
+        // unless texts were added or removed
+        if (static_cast<int>(std::size(nestedTexts)) == textComponent.getNumAppendices())
+        {
+            for (auto i = 0; i < textComponent.getNumAppendices(); i++)
+                textComponent.setAppendix(i, nestedTexts[static_cast<std::size_t>(i)]->getTextComponent().getAttributedString());
+
+            return;
+        }
+
+        textComponent.clearAttributes();
+
+        for (const auto* nestedText : nestedTexts)
+            textComponent.append(nestedText->getTextComponent().getAttributedString());
+    }
+
+    void Text::textContentChanged()
+    {
+        idealWidth = nextWholeNumberAbove(getMaxContentWidth());
 
         if (auto* parentItem = getParent())
         {
-            if (!parentItem->isContainer())
-                getTextComponent().setAccessible(false);
+            auto& parentDecorator = dynamic_cast<GuiItemDecorator&>(*parentItem).getTopLevelDecorator();
 
-            if (auto* containerParent = dynamic_cast<GuiItemDecorator&>(*parentItem).getTopLevelDecorator().toType<ContainerItem>())
+            if (auto* parentText = parentDecorator.toType<Text>())
+                parentText->nestedTextChanged(*this);
+            else if (auto* containerParent = parentDecorator.toType<ContainerItem>())
                 containerParent->updateIdealSizeUnrestrained();
         }
     }
@@ -181,6 +299,7 @@ namespace jive
 
 #if JIVE_UNIT_TESTS
     #include <jive_layouts/layout/jive_Interpreter.h>
+    #include <jive_layouts/layout/gui-items/jive_PerformanceReport.h>
 
 class TextTest : public juce::UnitTest
 {
@@ -198,6 +317,7 @@ public:
         testReadingDirection();
         testLineSpacing();
         testNested();
+        testRecolouring();
         testAutoSize();
     }
 
@@ -489,9 +609,74 @@ private:
                               .toType<jive::Text>();
             expectEquals<juce::String>(text.getTextComponent().getAttributedString().getText(),
                                        "Setup... Conflict... Revolution!");
+            expect(text.getNestedTextRange(*dynamic_cast<jive::GuiItemDecorator*>(text.getChildren()[1])
+                                                ->toType<jive::Text>())
+                   == juce::Range<int>{ 21, 32 });
+
+            beginTest("nested / incremental update");
+            tree.getChild(0).setProperty("text", "Rising action... ", nullptr);
+            expectEquals<juce::String>(text.getTextComponent().getAttributedString().getText(),
+                                       "Setup... Rising action... Revolution!");
+            expect(text.getNestedTextRange(*dynamic_cast<jive::GuiItemDecorator*>(text.getChildren()[1])
+                                                ->toType<jive::Text>())
+                   == juce::Range<int>{ 26, 37 });
         }
     }
 
+    void testRecolouring()
+    {
+        beginTest("recolouring");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 200 },
+            },
+            {
+                juce::ValueTree{
+                    "Text",
+                    {
+                        { "text", "Lorem " },
+                    },
+                    {
+                        juce::ValueTree{
+                            "Text",
+                            {
+                                { "text", "ipsum" },
+                            },
+                        },
+                    },
+                },
+            },
+        };
+        jive::Interpreter interpreter;
+        auto item = interpreter.interpret(tree);
+        auto& text = *dynamic_cast<jive::GuiItemDecorator*>(item->getChildren()[0])->toType<jive::Text>();
+        auto& nestedText = *dynamic_cast<jive::GuiItemDecorator*>(text.getChildren()[0])->toType<jive::Text>();
+        const auto version = text.getTextComponent().getVersion();
+
+        jive::PerformanceCounters::setEnabled(true);
+        jive::resetPerformanceCounters(*item);
+
+        // Each frame of a foreground transition sets the text colour
+        for (auto i = 1; i <= 10; i++)
+        {
+            const auto colour = juce::Colours::red.withAlpha(static_cast<float>(i) / 10.0f);
+            text.getTextComponent().setTextColour(colour);
+            nestedText.getTextComponent().setTextColour(colour);
+        }
+
+        const auto counters = jive::getPerformanceCounters(*item);
+        jive::PerformanceCounters::setEnabled(false);
+
+        expectEquals(counters.layouts, juce::uint32{ 0 });
+        expectEquals(counters.idealSizeCalculations, juce::uint32{ 0 });
+        expectEquals(text.getTextComponent().getVersion(), version);
+        expect(text.getTextComponent().getAttributedString().getAttribute(0).colour
+               == juce::Colours::red);
+    }
+
     void testAutoSize()
     {
         beginTest("auto size");
@@ -23,10 +23,27 @@ namespace jive
         TextComponent& getTextComponent();
         const TextComponent& getTextComponent() const;
 
+        float getMinContentWidth() const;
+        float getMaxContentWidth() const;
+
+        /** Returns the range of characters this text's nested text takes
+            up in this text's attributed string, or an empty range if it isn't
+            one of this text's children.
+        */
+        juce::Range<int> getNestedTextRange(const Text& nestedText) const;
+
     private:
         void textFontChanged(TextComponent& text) final;
+        void attributedStringChanged(TextComponent& text) final;
+        void attributedStringRecoloured(TextComponent& text) final;
 
-        juce::TextLayout buildTextLayout(float maxWidth = -1.0f) const;
+        int getNestedTextIndex(const Text& nestedText) const;
+        void nestedTextChanged(const Text& nestedText);
+        void textContentChanged();
+        void updateNestedTexts();
+
+        float getAvailableWidth(float maxWidth) const;
+        TextMetrics& getTextMetrics() const;
 
         void updateTextComponent();
 
@@ -38,6 +55,10 @@ namespace jive
         Property<float> idealWidth;
         Property<float> idealHeight;
 
+        mutable std::unique_ptr<TextMetrics> metrics;
+        mutable juce::uint32 metricsVersion{ 0 };
+        bool updatingTextComponent = false;
+
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Text)
     };
 
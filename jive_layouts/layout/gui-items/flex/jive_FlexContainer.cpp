@@ -36,11 +36,13 @@ namespace jive
             callLayoutChildrenWithRecursionLock();
         };
 
+        JIVE_INSTRUMENT(valueTreeListenersAdded, 1);
         state.addListener(this);
     }
 
     FlexContainer::~FlexContainer()
     {
+        JIVE_INSTRUMENT(valueTreeListenersRemoved, 1);
         state.removeListener(this);
     }
 
@@ -49,6 +51,8 @@ namespace jive
         if (layoutRecursionLock)
             return;
 
+        JIVE_PROFILE_TREE_SCOPE("FlexContainer::layOutChildren", state);
+
         const juce::ScopedValueSetter svs{ layoutRecursionLock, true };
 
         GuiItemDecorator::layOutChildren();
@@ -74,6 +78,8 @@ namespace jive
 
     juce::Rectangle<float> FlexContainer::calculateIdealSize(juce::Rectangle<float> constraints) const
     {
+        JIVE_PROFILE_TREE_SCOPE("FlexContainer::calculateIdealSize", state);
+
         constraints = constraints.withZeroOrigin();
 
         switch (flexDirection.getOr(juce::FlexBox{}.flexDirection))
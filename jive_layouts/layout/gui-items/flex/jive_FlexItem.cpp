@@ -56,11 +56,11 @@ namespace jive
         };
         order.onValueChange = updateParentLayout;
         flexGrow.onValueChange = updateParentLayout;
-        flexGrow.onTransitionProgressed = updateParentLayout;
+        flexGrow.onTransitionProgressed = countingTransitionTicks(updateParentLayout);
         flexShrink.onValueChange = updateParentLayout;
-        flexShrink.onTransitionProgressed = updateParentLayout;
+        flexShrink.onTransitionProgressed = countingTransitionTicks(updateParentLayout);
         flexBasis.onValueChange = updateParentLayout;
-        flexBasis.onTransitionProgressed = updateParentLayout;
+        flexBasis.onTransitionProgressed = countingTransitionTicks(updateParentLayout);
         alignSelf.onValueChange = updateParentLayout;
 
         box.addListener(*this);
@@ -59,15 +59,15 @@ namespace jive
         gridTemplateColumns.onValueChange = [this] {
             updateIdealSizeUnrestrained();
         };
-        gridTemplateColumns.onTransitionProgressed = [this] {
+        gridTemplateColumns.onTransitionProgressed = countingTransitionTicks([this] {
             updateIdealSizeUnrestrained();
-        };
+        });
         gridTemplateRows.onValueChange = [this] {
             updateIdealSizeUnrestrained();
         };
-        gridTemplateRows.onTransitionProgressed = [this] {
+        gridTemplateRows.onTransitionProgressed = countingTransitionTicks([this] {
             updateIdealSizeUnrestrained();
-        };
+        });
         gridTemplateAreas.onValueChange = [this] {
             updateIdealSizeUnrestrained();
         };
@@ -80,15 +80,17 @@ namespace jive
         gap.onValueChange = [this] {
             updateIdealSizeUnrestrained();
         };
-        gap.onTransitionProgressed = [this] {
+        gap.onTransitionProgressed = countingTransitionTicks([this] {
             updateIdealSizeUnrestrained();
-        };
+        });
 
+        JIVE_INSTRUMENT(valueTreeListenersAdded, 1);
         state.addListener(this);
     }
 
     GridContainer::~GridContainer()
     {
+        JIVE_INSTRUMENT(valueTreeListenersRemoved, 1);
         state.removeListener(this);
     }
 
@@ -97,6 +99,8 @@ namespace jive
         if (layoutRecursionLock)
             return;
 
+        JIVE_PROFILE_TREE_SCOPE("GridContainer::layOutChildren", state);
+
         const juce::ScopedValueSetter svs{ layoutRecursionLock, true };
 
         GuiItemDecorator::layOutChildren();
@@ -123,6 +127,8 @@ namespace jive
 
     juce::Rectangle<float> GridContainer::calculateIdealSize(juce::Rectangle<float> constraints) const
     {
+        JIVE_PROFILE_TREE_SCOPE("GridContainer::calculateIdealSize", state);
+
         auto integerConstraints = constraints.toNearestInt().withZeroOrigin();
         integerConstraints.setHeight(static_cast<int>(std::numeric_limits<juce::uint16>::max()));
 
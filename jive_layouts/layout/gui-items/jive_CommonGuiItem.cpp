@@ -127,7 +127,7 @@ namespace jive
             getComponent()->setAlpha(opacity.calculateCurrent());
         };
         opacity.onValueChange = updateOpacity;
-        opacity.onTransitionProgressed = updateOpacity;
+        opacity.onTransitionProgressed = countingTransitionTicks(updateOpacity);
         getComponent()->setAlpha(opacity);
 
         cursor.onValueChange = [this]() {
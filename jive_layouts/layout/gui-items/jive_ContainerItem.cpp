@@ -53,6 +53,7 @@ namespace jive
 
     void ContainerItem::updateIdealSize(juce::Rectangle<float> constraints)
     {
+        getPerformanceCounters().countIdealSizeCalculation();
         const auto newIdealSize = calculateIdealSize(constraints);
         const auto widthChanged = !juce::approximatelyEqual(newIdealSize.getWidth(), idealWidth.get());
         const auto heightChanged = !juce::approximatelyEqual(newIdealSize.getHeight(), idealHeight.get());
@@ -71,10 +71,11 @@ namespace jive
 #endif
         , component{ comp }
         , parent{ parentItem }
-        , remover{ std::make_unique<Remover>(*this) }
+        , remover{ *this }
         , view{ sourceView }
     {
         jassert(component != nullptr);
+        JIVE_INSTRUMENT(guiItemsCreated, 1);
     }
 
     GuiItem::GuiItem(std::unique_ptr<juce::Component> comp,
@@ -125,9 +126,21 @@ namespace jive
 
     GuiItem::~GuiItem()
     {
+        JIVE_INSTRUMENT(guiItemsDestroyed, 1);
+        PropertyTransaction::cancel(this);
         masterReference.clear();
     }
 
+    void* GuiItem::operator new(std::size_t size)
+    {
+        return BlockPool::getItemPool().allocate(size);
+    }
+
+    void GuiItem::operator delete(void* block, std::size_t size) noexcept
+    {
+        BlockPool::getItemPool().deallocate(block, size);
+    }
+
     const std::shared_ptr<const juce::Component> GuiItem::getComponent() const
     {
         return component;
@@ -224,8 +237,18 @@ namespace jive
         if (isLayingOutChildren() || std::size(getChildren()) == 0)
             return;
 
+        // Lay out once when the transaction completes, rather than after every
+        // change made during it
+        const auto deferred = PropertyTransaction::deferUntilComplete(state, this, [this] {
+            callLayoutChildrenWithRecursionLock();
+        });
+
+        if (deferred)
+            return;
+
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
         const juce::ScopedValueSetter svs{ layoutRecursionLock, true };
+        const PerformanceCounters::ScopedLayoutTimer layoutTimer{ getPerformanceCounters() };
         layOutChildren();
     }
 
@@ -234,18 +257,42 @@ namespace jive
         return layoutRecursionLock;
     }
 
+    PerformanceCounters& GuiItem::getPerformanceCounters()
+    {
+        return performanceCounters;
+    }
+
+    const PerformanceCounters& GuiItem::getPerformanceCounters() const
+    {
+        return performanceCounters;
+    }
+
+    std::function<void()> GuiItem::countingTransitionTicks(std::function<void()> onTransitionProgressed)
+    {
+        return [this, onTransitionProgressed = std::move(onTransitionProgressed)] {
+            getPerformanceCounters().countTransitionTick();
+            onTransitionProgressed();
+        };
+    }
+
     GuiItem::Remover::Remover(GuiItem& guiItem)
         : item{ guiItem }
         , parent{ item.getParent() }
     {
         if (parent != nullptr)
+        {
+            JIVE_INSTRUMENT(valueTreeListenersAdded, 1);
             parent->state.addListener(this);
+        }
     }
 
     GuiItem::Remover::~Remover()
     {
         if (parent != nullptr)
+        {
+            JIVE_INSTRUMENT(valueTreeListenersRemoved, 1);
             parent->state.removeListener(this);
+        }
     }
 
     void GuiItem::Remover::valueTreeChildRemoved(juce::ValueTree&,
@@ -30,6 +30,13 @@ namespace jive
         GuiItem(const GuiItem& other);
         virtual ~GuiItem();
 
+        /** Items and their decorators are allocated from a shared BlockPool,
+            so the items of a view are packed into a few large chunks of
+            memory rather than each being a separate heap allocation.
+        */
+        [[nodiscard]] static void* operator new(std::size_t size);
+        static void operator delete(void* block, std::size_t size) noexcept;
+
         [[nodiscard]] const std::shared_ptr<const juce::Component> getComponent() const;
         [[nodiscard]] std::shared_ptr<juce::Component> getComponent();
         [[nodiscard]] const View::ReferenceCountedPointer getView() const;
@@ -50,12 +57,20 @@ namespace jive
         void callLayoutChildrenWithRecursionLock();
         [[nodiscard]] bool isLayingOutChildren() const;
 
+        /** Returns the counters shared by every decorator of this item. They
+            only accumulate while PerformanceCounters::isEnabled().
+        */
+        [[nodiscard]] virtual PerformanceCounters& getPerformanceCounters();
+        [[nodiscard]] virtual const PerformanceCounters& getPerformanceCounters() const;
+
         juce::ValueTree state;
 
     protected:
         virtual void layOutChildren() {}
         virtual void childrenChanged() {}
 
+        [[nodiscard]] std::function<void()> countingTransitionTicks(std::function<void()> onTransitionProgressed);
+
     private:
         friend class GuiItemDecorator;
 
@@ -90,10 +105,11 @@ namespace jive
         const std::shared_ptr<juce::Component> component;
         GuiItem* const parent;
         juce::OwnedArray<GuiItem> children;
-        std::unique_ptr<Remover> remover;
+        Remover remover;
         View::ReferenceCountedPointer view;
 
         bool layoutRecursionLock = false;
+        PerformanceCounters performanceCounters;
 
         JUCE_DECLARE_WEAK_REFERENCEABLE(GuiItem)
         JUCE_LEAK_DETECTOR(GuiItem)
@@ -82,6 +82,16 @@ namespace jive
         return *this;
     }
 
+    PerformanceCounters& GuiItemDecorator::getPerformanceCounters()
+    {
+        return item->getPerformanceCounters();
+    }
+
+    const PerformanceCounters& GuiItemDecorator::getPerformanceCounters() const
+    {
+        return item->getPerformanceCounters();
+    }
+
     void GuiItemDecorator::layOutChildren()
     {
         item->layOutChildren();
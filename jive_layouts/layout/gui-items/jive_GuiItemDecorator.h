@@ -20,6 +20,9 @@ namespace jive
         bool isContainer() const override;
         bool isContent() const override;
 
+        PerformanceCounters& getPerformanceCounters() override;
+        const PerformanceCounters& getPerformanceCounters() const override;
+
         GuiItemDecorator& getTopLevelDecorator();
         const GuiItemDecorator& getTopLevelDecorator() const;
 
@@ -0,0 +1,139 @@
+#include "jive_PerformanceReport.h"
+
+namespace jive
+{
+    PerformanceCounters getPerformanceCounters(const GuiItem& item)
+    {
+        auto counters = item.getPerformanceCounters();
+
+#if JIVE_GUI_ITEMS_HAVE_STYLE_SHEETS
+        if (const auto* styleSheet = dynamic_cast<const StyleSheet*>(item.getComponent()->getProperties()["style-sheet"].getObject()))
+            counters += styleSheet->getPerformanceCounters();
+#endif
+
+        return counters;
+    }
+
+    [[nodiscard]] static PerformanceCounters addPerformanceReport(const GuiItem& item, juce::DynamicObject& node)
+    {
+        const auto ownCounters = getPerformanceCounters(item);
+        auto subtreeCounters = ownCounters;
+        juce::Array<juce::var> children;
+
+        for (const auto* child : item.getChildren())
+        {
+            auto childNode = std::make_unique<juce::DynamicObject>();
+            subtreeCounters += addPerformanceReport(*child, *childNode);
+            children.add(childNode.release());
+        }
+
+        node.setProperty("type", item.state.getType().toString());
+
+        if (item.state.hasProperty("id"))
+            node.setProperty("id", item.state["id"]);
+
+        node.setProperty("counters", ownCounters.toVar());
+        node.setProperty("subtree", subtreeCounters.toVar());
+        node.setProperty("children", children);
+
+        return subtreeCounters;
+    }
+
+    juce::var createPerformanceReport(const GuiItem& root)
+    {
+        auto node = std::make_unique<juce::DynamicObject>();
+        juce::ignoreUnused(addPerformanceReport(root, *node));
+        return node.release();
+    }
+
+    void resetPerformanceCounters(GuiItem& root)
+    {
+        root.getPerformanceCounters().reset();
+
+#if JIVE_GUI_ITEMS_HAVE_STYLE_SHEETS
+        if (auto* styleSheet = dynamic_cast<StyleSheet*>(root.getComponent()->getProperties()["style-sheet"].getObject()))
+            styleSheet->resetPerformanceCounters();
+#endif
+
+        for (auto* child : root.getChildren())
+            resetPerformanceCounters(*child);
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+    #include <jive_layouts/layout/jive_Interpreter.h>
+
+class PerformanceReportUnitTest : public juce::UnitTest
+{
+public:
+    PerformanceReportUnitTest()
+        : juce::UnitTest{ "jive::PerformanceReport", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testReport();
+    }
+
+private:
+    void testReport()
+    {
+        beginTest("report");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "id", "root" },
+                { "width", 200 },
+                { "height", 100 },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", 10 },
+                        { "height", 10 },
+                    },
+                },
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", 10 },
+                        { "height", 10 },
+                    },
+                },
+            },
+        };
+        jive::Interpreter interpreter;
+        auto item = interpreter.interpret(tree);
+
+        jive::PerformanceCounters::setEnabled(true);
+        jive::resetPerformanceCounters(*item);
+
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        tree.setProperty("width", 300, nullptr);
+        tree.getChild(0).setProperty("width", 20, nullptr);
+        const auto elapsedMilliseconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks) * 1000.0;
+
+        const auto report = jive::createPerformanceReport(*item);
+        jive::PerformanceCounters::setEnabled(false);
+
+        expectEquals(report["type"].toString(), juce::String{ "Component" });
+        expectEquals(report["id"].toString(), juce::String{ "root" });
+        expectEquals(report["children"].size(), 2);
+        expect(static_cast<int>(report["subtree"]["layouts"]) > 0);
+        expect(static_cast<int>(report["subtree"]["layouts"]) >= static_cast<int>(report["counters"]["layouts"]));
+        expect(static_cast<int>(report["subtree"]["ideal-size-calculations"]) > 0);
+
+        // Nested layouts aren't counted twice, so the subtree can't have
+        // spent longer laying out than the changes took
+        expect(static_cast<double>(report["subtree"]["layout-ms"]) <= elapsedMilliseconds);
+
+        jive::resetPerformanceCounters(*item);
+        expectEquals(jive::getPerformanceCounters(*item).layouts, juce::uint32{ 0 });
+    }
+};
+
+static PerformanceReportUnitTest performanceReportUnitTest;
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "jive_GuiItem.h"
+
+namespace jive
+{
+    /** Returns the item's own counters, plus those of its style sheet if
+        GuiItems have style sheets.
+    */
+    [[nodiscard]] PerformanceCounters getPerformanceCounters(const GuiItem& item);
+
+    /** Returns a tree mirroring the given item's, where every node holds the
+        item's type and id, its own counters, and the totals for its whole
+        subtree.
+
+        Each item's layout time excludes the time spent laying out other items
+        while it was being laid out, so the subtree totals are the time spent
+        laying out the subtree as a whole.
+    */
+    [[nodiscard]] juce::var createPerformanceReport(const GuiItem& root);
+
+    void resetPerformanceCounters(GuiItem& root);
+} // namespace jive
@@ -102,6 +102,7 @@ namespace jive
         getComboBox().setSelectedItemIndex(selected);
         getComboBox().addListener(this);
 
+        JIVE_INSTRUMENT(valueTreeListenersAdded, 1);
         state.addListener(this);
 
         if (width.isAuto())
@@ -110,6 +111,12 @@ namespace jive
             height = "20";
     }
 
+    ComboBox::~ComboBox()
+    {
+        JIVE_INSTRUMENT(valueTreeListenersRemoved, 1);
+        state.removeListener(this);
+    }
+
     bool ComboBox::isContainer() const
     {
         return false;
@@ -43,6 +43,7 @@ namespace jive
         };
 
         explicit ComboBox(std::unique_ptr<GuiItem> itemToDecorate);
+        ~ComboBox() override;
 
         bool isContainer() const override;
 
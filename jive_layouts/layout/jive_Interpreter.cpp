@@ -49,6 +49,9 @@ namespace jive
         customDecorators.emplace_back(itemType, [](std::unique_ptr<GuiItem> item) {
             return std::make_unique<Decorator>(std::move(item));
         });
+
+        // The chains refer to the custom decorators, so are recompiled
+        decoratorChains.clear();
     }
 
     std::unique_ptr<GuiItem> Interpreter::interpret(const juce::ValueTree& tree, juce::AudioProcessor* pluginProcessor) const
@@ -74,9 +77,13 @@ namespace jive
     void Interpreter::listenTo(GuiItem& item)
     {
         if (observedItem != nullptr)
+        {
+            JIVE_INSTRUMENT(valueTreeListenersRemoved, 1);
             observedItem->state.removeListener(this);
+        }
 
         observedItem = &item;
+        JIVE_INSTRUMENT(valueTreeListenersAdded, 1);
         observedItem->state.addListener(this);
     }
 
@@ -107,18 +114,32 @@ namespace jive
         }
     }
 
-    static std::unique_ptr<GuiItem> decorateWithDisplayBehaviour(std::unique_ptr<GuiItem> item)
+    using DecorateFunction = std::unique_ptr<GuiItem> (*)(std::unique_ptr<GuiItem>);
+
+    template <typename Decorator>
+    static std::unique_ptr<GuiItem> decorateWith(std::unique_ptr<GuiItem> item)
     {
-        Property<Display> display{ item->state, "display" };
+        return std::make_unique<Decorator>(std::move(item));
+    }
+
+    [[nodiscard]] static Display getDisplay(const juce::ValueTree& state)
+    {
+        // Read once, rather than through a Property that would listen to
+        // the tree. CommonGuiItem makes sure every item has a display.
+        static const juce::Identifier displayProperty{ "display" };
+        return juce::VariantConverter<Display>::fromVar(state[displayProperty]);
+    }
 
-        switch (display.get())
+    [[nodiscard]] static DecorateFunction getContainerDecorator(Display display)
+    {
+        switch (display)
         {
         case Display::flex:
-            return std::make_unique<FlexContainer>(std::move(item));
+            return decorateWith<FlexContainer>;
         case Display::grid:
-            return std::make_unique<GridContainer>(std::move(item));
+            return decorateWith<GridContainer>;
         case Display::block:
-            return std::make_unique<BlockContainer>(std::move(item));
+            return decorateWith<BlockContainer>;
         }
 
         // Unhandled display type!
@@ -126,21 +147,16 @@ namespace jive
         return nullptr;
     }
 
-    static std::unique_ptr<GuiItem> decorateWithHereditaryBehaviour(std::unique_ptr<GuiItem> item)
+    [[nodiscard]] static DecorateFunction getItemDecorator(Display parentDisplay)
     {
-        if (item->getParent() == nullptr)
-            return item;
-
-        Property<Display> display{ item->state.getParent(), "display" };
-
-        switch (display.get())
+        switch (parentDisplay)
         {
         case Display::flex:
-            return std::make_unique<FlexItem>(std::move(item));
+            return decorateWith<FlexItem>;
         case Display::grid:
-            return std::make_unique<GridItem>(std::move(item));
+            return decorateWith<GridItem>;
         case Display::block:
-            return std::make_unique<BlockItem>(std::move(item));
+            return decorateWith<BlockItem>;
         }
 
         // Unhandled display type!
@@ -148,68 +164,102 @@ namespace jive
         return nullptr;
     }
 
-    static std::unique_ptr<GuiItem> decorateWithWidgetBehaviour(std::unique_ptr<GuiItem> item)
-    {
-        const auto name = item->state.getType().toString();
-
-        if (name == "Button" || name == "Checkbox")
-            return std::make_unique<Button>(std::move(item));
-        if (name == "ComboBox")
-            return std::make_unique<ComboBox>(std::move(item));
-        if (name == "Hyperlink")
-            return std::make_unique<Hyperlink>(std::move(item));
-        if (name == "Image" || name.compareIgnoreCase("svg") == 0)
-            return std::make_unique<Image>(std::move(item));
-        if (name == "Knob")
-            return std::make_unique<Knob>(std::move(item));
-        if (name == "Label")
-            return std::make_unique<Label>(std::move(item));
-        if (name == "ProgressBar")
-            return std::make_unique<ProgressBar>(std::move(item));
-        if (name == "Slider")
-            return std::make_unique<Slider>(std::move(item));
-        if (name == "Spinner")
-            return std::make_unique<Spinner>(std::move(item));
-        if (name == "Text")
-            return std::make_unique<Text>(std::move(item));
-        if (name == "Window")
-            return std::make_unique<Window>(std::move(item));
+    [[nodiscard]] static DecorateFunction getWidgetDecorator(const juce::Identifier& type)
+    {
+        static const std::unordered_map<juce::Identifier, DecorateFunction> widgetDecorators{
+            { "Button", decorateWith<Button> },
+            { "Checkbox", decorateWith<Button> },
+            { "ComboBox", decorateWith<ComboBox> },
+            { "Hyperlink", decorateWith<Hyperlink> },
+            { "Image", decorateWith<Image> },
+            { "Knob", decorateWith<Knob> },
+            { "Label", decorateWith<Label> },
+            { "ProgressBar", decorateWith<ProgressBar> },
+            { "Slider", decorateWith<Slider> },
+            { "Spinner", decorateWith<Spinner> },
+            { "Text", decorateWith<Text> },
+            { "Window", decorateWith<Window> },
+        };
 
-        return item;
+        if (const auto widget = widgetDecorators.find(type);
+            widget != std::end(widgetDecorators))
+        {
+            return widget->second;
+        }
+
+        if (Image::isInlineSVG(type))
+            return decorateWith<Image>;
+
+        return nullptr;
     }
 
-    using DecoratorCreator = std::function<std::unique_ptr<GuiItemDecorator>(std::unique_ptr<GuiItem>)>;
+    bool Interpreter::DecoratorChainKey::operator==(const DecoratorChainKey& other) const noexcept
+    {
+        return type == other.type
+            && display == other.display
+            && parentDisplay == other.parentDisplay;
+    }
 
-    static std::vector<const DecoratorCreator*> collectDecoratorCreators(const juce::Identifier& itemType,
-                                                                         const std::vector<std::pair<juce::Identifier, DecoratorCreator>>& decorators)
+    std::size_t Interpreter::DecoratorChainKeyHash::operator()(const DecoratorChainKey& key) const noexcept
     {
-        std::vector<const DecoratorCreator*> creators;
+        return hashAll(key.type,
+                       static_cast<int>(key.display),
+                       key.parentDisplay.has_value() ? static_cast<int>(*key.parentDisplay) : -1);
+    }
 
-        for (const auto& decorator : decorators)
+    const Interpreter::DecoratorChain& Interpreter::getDecoratorChain(const DecoratorChainKey& key) const
+    {
+        if (const auto chain = decoratorChains.find(key);
+            chain != std::end(decoratorChains))
         {
-            if (decorator.first == itemType)
-                creators.push_back(&decorator.second);
+            return chain->second;
         }
 
-        return creators;
+        DecoratorChain chain;
+
+        if (key.parentDisplay.has_value())
+            chain.itemDecorator = getItemDecorator(*key.parentDisplay);
+
+        chain.widgetDecorator = getWidgetDecorator(key.type);
+        chain.containerDecorator = getContainerDecorator(key.display);
+
+        for (std::size_t i = 0; i < std::size(customDecorators); i++)
+        {
+            if (customDecorators[i].first == key.type)
+                chain.customDecoratorIndices.push_back(i);
+        }
+
+#if JIVE_IS_PLUGIN_PROJECT
+        static const juce::Identifier editorType{ "Editor" };
+        chain.isPluginEditor = key.type == editorType;
+#endif
+
+        return decoratorChains.emplace(key, std::move(chain)).first->second;
     }
 
-    static std::unique_ptr<GuiItem> decorate(std::unique_ptr<GuiItem> item,
-                                             const std::vector<std::pair<juce::Identifier, DecoratorCreator>>& customDecorators,
-                                             [[maybe_unused]] juce::AudioProcessor* pluginProcessor)
+    std::unique_ptr<GuiItem> Interpreter::decorate(std::unique_ptr<GuiItem> item,
+                                                   [[maybe_unused]] juce::AudioProcessor* pluginProcessor) const
     {
         item = std::make_unique<CommonGuiItem>(std::move(item));
-        item = decorateWithHereditaryBehaviour(std::move(item));
-        item = decorateWithWidgetBehaviour(std::move(item));
 
-        if (!item->isContent())
-            item = decorateWithDisplayBehaviour(std::move(item));
+        const auto& chain = getDecoratorChain({
+            item->state.getType(),
+            getDisplay(item->state),
+            item->getParent() != nullptr ? std::make_optional(getDisplay(item->state.getParent())) : std::nullopt,
+        });
+
+        if (chain.itemDecorator != nullptr)
+            item = chain.itemDecorator(std::move(item));
+        if (chain.widgetDecorator != nullptr)
+            item = chain.widgetDecorator(std::move(item));
+        if (chain.containerDecorator != nullptr && !item->isContent())
+            item = chain.containerDecorator(std::move(item));
 
-        for (const auto* decorateWithCustomDecorations : collectDecoratorCreators(item->state.getType(), customDecorators))
-            item = (*decorateWithCustomDecorations)(std::move(item));
+        for (const auto index : chain.customDecoratorIndices)
+            item = customDecorators[index].second(std::move(item));
 
 #if JIVE_IS_PLUGIN_PROJECT
-        if (item->state.getType().toString() == "Editor")
+        if (chain.isPluginEditor)
             item = std::make_unique<PluginEditor>(std::move(item), pluginProcessor);
 #endif
 
@@ -229,17 +279,26 @@ namespace jive
                                                     GuiItem* const parent,
                                                     juce::AudioProcessor* pluginProcessor) const
     {
-        auto item = createUndecoratedItem(tree, parent);
+        JIVE_PROFILE_TREE_SCOPE("Interpreter::interpret", tree);
+
+        std::unique_ptr<GuiItem> item;
 
-        if (item != nullptr)
         {
-            item = decorate(std::move(item), customDecorators, pluginProcessor);
-            setChildItems(*item);
+            // Deliver the properties set while building the item, and lay it
+            // out, once it's complete rather than after every change
+            const PropertyTransaction transaction{ tree };
+            item = createUndecoratedItem(tree, parent);
 
-            if (item->isTopLevel())
-                setupItemsRecursive(*item);
+            if (item != nullptr)
+            {
+                item = decorate(std::move(item), pluginProcessor);
+                setChildItems(*item);
+            }
         }
 
+        if (item != nullptr && item->isTopLevel())
+            setupItemsRecursive(*item);
+
         return item;
     }
 
@@ -356,6 +415,7 @@ public:
         testInitialLayout();
         testWindowContent();
         testCustomDecorators();
+        testDecoratorChains();
         testAliases();
         testInterpretingDifferentSources();
         testInterpretingContentAndContainers();
@@ -632,6 +692,52 @@ private:
         expect(decorator->toType<MyOtherDecorator>() != nullptr);
     }
 
+    void testDecoratorChains()
+    {
+        beginTest("decorator chains");
+
+        const jive::Interpreter interpreter;
+
+        // Items of the same type share a chain, but only with items that
+        // have the same display and parent display
+        const auto view = interpreter.interpret(juce::ValueTree{
+            "Component",
+            {
+                { "width", 222 },
+                { "height", 333 },
+                { "display", "grid" },
+            },
+            {
+                juce::ValueTree{ "Text" },
+                juce::ValueTree{ "Component", { { "display", "block" } }, { juce::ValueTree{ "Text" } } },
+                juce::ValueTree{ "Component", {}, { juce::ValueTree{ "Text" } } },
+            },
+        });
+        auto& root = dynamic_cast<jive::GuiItemDecorator&>(*view);
+        expect(root.toType<jive::GridContainer>() != nullptr);
+        expect(root.toType<jive::GridItem>() == nullptr);
+
+        const auto getChild = [&view](int index) -> jive::GuiItemDecorator& {
+            return dynamic_cast<jive::GuiItemDecorator&>(*view->getChildren()[index]);
+        };
+        expect(getChild(0).toType<jive::Text>() != nullptr);
+        expect(getChild(0).toType<jive::GridItem>() != nullptr);
+        expect(getChild(0).toType<jive::FlexContainer>() == nullptr);
+
+        expect(getChild(1).toType<jive::BlockContainer>() != nullptr);
+        expect(getChild(1).toType<jive::GridItem>() != nullptr);
+        expect(getChild(2).toType<jive::FlexContainer>() != nullptr);
+        expect(getChild(2).toType<jive::GridItem>() != nullptr);
+
+        const auto getGrandchild = [&view](int index) -> jive::GuiItemDecorator& {
+            return dynamic_cast<jive::GuiItemDecorator&>(*view->getChildren()[index]->getChildren()[0]);
+        };
+        expect(getGrandchild(1).toType<jive::Text>() != nullptr);
+        expect(getGrandchild(1).toType<jive::BlockItem>() != nullptr);
+        expect(getGrandchild(2).toType<jive::Text>() != nullptr);
+        expect(getGrandchild(2).toType<jive::FlexItem>() != nullptr);
+    }
+
     void testAliases()
     {
         beginTest("aliases");
@@ -715,6 +821,39 @@ private:
             const auto result = interpreter.interpret(source.toRawUTF8(), source.length());
             expect(result != nullptr);
         }
+        {
+            beginTest("interpreting a compiled binary view");
+
+            const juce::String source = R"(
+                <Component width="300" height="200" display="grid" padding="10"
+                           grid-template-columns="1fr 2fr" grid-template-rows="1fr 2fr">
+                    <Component grid-column="1 / 3" margin="5"/>
+                    <Component display="flex" flex-direction="column" padding="2">
+                        <Text flex-grow="1">Hello</Text>
+                        <Component height="20" flex-shrink="0"/>
+                    </Component>
+                    <Component display="block">
+                        <Component x="10" y="20" width="30" height="40"/>
+                    </Component>
+                </Component>
+            )";
+            const auto binary = jive::compileBinaryView(jive::parseXML(source));
+
+            const jive::Interpreter interpreter;
+            const auto fromXML = interpreter.interpret(source);
+            const auto fromBinary = interpreter.interpret(binary.getData(), static_cast<int>(binary.getSize()));
+            expect(fromBinary != nullptr);
+            expectSameLayout(*fromXML, *fromBinary);
+        }
+    }
+
+    void expectSameLayout(const jive::GuiItem& expected, const jive::GuiItem& actual)
+    {
+        expectEquals(actual.getComponent()->getBounds(), expected.getComponent()->getBounds());
+        expectEquals(actual.getChildren().size(), expected.getChildren().size());
+
+        for (auto i = 0; i < juce::jmin(actual.getChildren().size(), expected.getChildren().size()); i++)
+            expectSameLayout(*expected.getChildren()[i], *actual.getChildren()[i]);
     }
 
     void testInterpretingContentAndContainers()
@@ -2,6 +2,7 @@
 
 #include <jive_layouts/layout/gui-items/jive_GuiItemDecorator.h>
 #include <jive_layouts/utilities/jive_ComponentFactory.h>
+#include <jive_layouts/utilities/jive_Display.h>
 
 namespace juce
 {
@@ -37,6 +38,34 @@ namespace jive
         void listenTo(GuiItem& item);
 
     private:
+        using DecoratorCreator = std::function<std::unique_ptr<GuiItemDecorator>(std::unique_ptr<GuiItem>)>;
+        using Decorate = std::unique_ptr<GuiItem> (*)(std::unique_ptr<GuiItem>);
+
+        // Everything that decides which decorators an item gets
+        struct DecoratorChainKey
+        {
+            [[nodiscard]] bool operator==(const DecoratorChainKey& other) const noexcept;
+
+            juce::Identifier type;
+            Display display;
+            std::optional<Display> parentDisplay;
+        };
+
+        struct DecoratorChainKeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const DecoratorChainKey& key) const noexcept;
+        };
+
+        // The decorators to apply, in order, to every item with a given key
+        struct DecoratorChain
+        {
+            Decorate itemDecorator = nullptr;
+            Decorate widgetDecorator = nullptr;
+            Decorate containerDecorator = nullptr;
+            std::vector<std::size_t> customDecoratorIndices;
+            bool isPluginEditor = false;
+        };
+
         void valueTreeChildAdded(juce::ValueTree& parentTree,
                                  juce::ValueTree& childWhichHasBeenAdded) final;
 
@@ -52,10 +81,13 @@ namespace jive
         void setChildItems(GuiItem& item) const;
 
         std::unique_ptr<juce::Component> createComponent(const juce::ValueTree& tree, const GuiItem* parent) const;
+        std::unique_ptr<GuiItem> decorate(std::unique_ptr<GuiItem> item, juce::AudioProcessor* pluginProcessor) const;
+        const DecoratorChain& getDecoratorChain(const DecoratorChainKey& key) const;
         void setupItemsRecursive(GuiItem& item) const;
 
         ComponentFactory componentFactory;
-        std::vector<std::pair<juce::Identifier, std::function<std::unique_ptr<GuiItemDecorator>(std::unique_ptr<GuiItem>)>>> customDecorators;
+        std::vector<std::pair<juce::Identifier, DecoratorCreator>> customDecorators;
+        mutable std::unordered_map<DecoratorChainKey, DecoratorChain, DecoratorChainKeyHash> decoratorChains;
         std::unordered_map<juce::Identifier, juce::ValueTree> aliases;
 
         juce::WeakReference<GuiItem> observedItem = nullptr;
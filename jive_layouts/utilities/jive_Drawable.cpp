@@ -1,35 +1,11 @@
 #include "jive_Drawable.h"
 
+#include "jive_DrawableStore.h"
+
 #include <jive_core/jive_core.h>
 
 namespace jive
 {
-    Drawable::Drawable(const Drawable& other)
-    {
-        *this = other;
-    }
-
-    Drawable& Drawable::operator=(const Drawable& other)
-    {
-        if (other.drawable != nullptr)
-            drawable = other.drawable->createCopy();
-
-        svgSource = other.svgSource;
-        return *this;
-    }
-
-    Drawable::Drawable(Drawable&& other)
-    {
-        *this = std::move(other);
-    }
-
-    Drawable& Drawable::operator=(Drawable&& other)
-    {
-        drawable = std::move(other.drawable);
-        svgSource = std::move(other.svgSource);
-        return *this;
-    }
-
     Drawable::Drawable(juce::Image image)
     {
         *this = image;
@@ -38,13 +14,14 @@ namespace jive
     Drawable& Drawable::operator=(juce::Image image)
     {
         svgSource.clear();
-        drawable = std::make_unique<juce::DrawableImage>(image);
+        drawable = DrawableStore::getInstance()->getImage(image);
+        hasUniqueCopy = false;
         return *this;
     }
 
     Drawable::operator juce::Image() const
     {
-        return dynamic_cast<juce::DrawableImage&>(*drawable).getImage();
+        return dynamic_cast<const juce::DrawableImage&>(*drawable).getImage();
     }
 
     bool Drawable::isImage() const
@@ -65,17 +42,14 @@ namespace jive
     Drawable& Drawable::operator=(const juce::String& svgString)
     {
         svgSource = svgString;
-        *this = *juce::parseXML(svgString);
+        drawable = DrawableStore::getInstance()->getSVG(svgString);
+        hasUniqueCopy = false;
         return *this;
     }
 
     Drawable& Drawable::operator=(const juce::XmlElement& svgElement)
     {
-        if (svgSource.isEmpty())
-            svgSource = svgElement.toString();
-
-        drawable = juce::Drawable::createFromSVG(svgElement);
-        return *this;
+        return *this = svgElement.toString();
     }
 
     Drawable::operator juce::String() const
@@ -92,6 +66,37 @@ namespace jive
     {
         return drawable == nullptr;
     }
+
+    const juce::Drawable* Drawable::getDrawable() const
+    {
+        return drawable.get();
+    }
+
+    juce::Drawable& Drawable::getMutableDrawable()
+    {
+        jassert(drawable != nullptr);
+
+        if (!hasUniqueCopy || drawable.use_count() > 1)
+        {
+            drawable = drawable->createCopy();
+            hasUniqueCopy = true;
+        }
+
+        return *drawable;
+    }
+
+    std::unique_ptr<juce::Drawable> Drawable::createCopy() const
+    {
+        if (drawable == nullptr)
+            return nullptr;
+
+        return drawable->createCopy();
+    }
+
+    bool Drawable::sharesDataWith(const Drawable& other) const
+    {
+        return drawable != nullptr && drawable == other.drawable;
+    }
 } // namespace jive
 
 namespace juce
@@ -123,3 +128,59 @@ namespace juce
         return str << "Drawable{}";
     }
 } // namespace juce
+
+#if JIVE_UNIT_TESTS
+class DrawableTest : public juce::UnitTest
+{
+public:
+    DrawableTest()
+        : juce::UnitTest{ "jive::Drawable", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSharing();
+        testCopyOnWrite();
+    }
+
+private:
+    static constexpr auto svg = R"(<svg width="20" height="10"><rect width="20" height="10"/></svg>)";
+
+    void testSharing()
+    {
+        beginTest("sharing");
+
+        const jive::Drawable first{ juce::String{ svg } };
+        const jive::Drawable second{ juce::String{ svg } };
+        expect(first.sharesDataWith(second));
+
+        const auto copy = first;
+        expect(copy.sharesDataWith(first));
+
+        const juce::Image image{ juce::Image::ARGB, 10, 10, true };
+        const jive::Drawable firstImage{ image };
+        const jive::Drawable secondImage{ image };
+        expect(firstImage.sharesDataWith(secondImage));
+        expect(!firstImage.sharesDataWith(first));
+    }
+
+    void testCopyOnWrite()
+    {
+        beginTest("copy-on-write");
+
+        const jive::Drawable original{ juce::String{ svg } };
+        auto mutated = original;
+        auto& mutableDrawable = mutated.getMutableDrawable();
+        expect(!mutated.sharesDataWith(original));
+        expect(&mutableDrawable != original.getDrawable());
+        expect(&mutated.getMutableDrawable() == &mutableDrawable);
+
+        const jive::Drawable later{ juce::String{ svg } };
+        expect(later.sharesDataWith(original));
+        expect(!later.sharesDataWith(mutated));
+    }
+};
+
+static DrawableTest drawableTest;
+#endif
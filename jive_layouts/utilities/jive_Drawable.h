@@ -4,14 +4,17 @@
 
 namespace jive
 {
+    /** An image or SVG drawable with value semantics.
+
+        Drawables created from the same SVG source or juce::Image share a
+        single interned juce::Drawable, as do copies of a Drawable. The shared
+        data is only cloned when getMutableDrawable() is called on a Drawable
+        that isn't its sole owner.
+    */
     class Drawable
     {
     public:
         Drawable() = default;
-        Drawable(const Drawable& other);
-        Drawable& operator=(const Drawable& other);
-        Drawable(Drawable&& other);
-        Drawable& operator=(Drawable&& other);
 
         explicit Drawable(juce::Image image);
         Drawable& operator=(juce::Image image);
@@ -27,9 +30,15 @@ namespace jive
 
         bool isEmpty() const;
 
+        const juce::Drawable* getDrawable() const;
+        juce::Drawable& getMutableDrawable();
+        std::unique_ptr<juce::Drawable> createCopy() const;
+        bool sharesDataWith(const Drawable& other) const;
+
     private:
-        std::unique_ptr<juce::Drawable> drawable;
+        std::shared_ptr<juce::Drawable> drawable;
         juce::String svgSource;
+        bool hasUniqueCopy = false;
 
         JUCE_LEAK_DETECTOR(Drawable)
     };
@@ -0,0 +1,146 @@
+#include "jive_DrawableStore.h"
+
+#include "jive_SvgCache.h"
+
+namespace jive
+{
+    std::size_t DrawableStore::SourceHash::operator()(const juce::String& source) const noexcept
+    {
+        return static_cast<std::size_t>(source.hash());
+    }
+
+    DrawableStore::~DrawableStore()
+    {
+        clearSingletonInstance();
+    }
+
+    template <typename Map, typename Key, typename Factory>
+    DrawableStore::SharedDrawable DrawableStore::getOrCreate(Map& map, const Key& key, Factory&& create)
+    {
+        if (const auto existing = map.find(key);
+            existing != std::end(map))
+        {
+            if (auto drawable = existing->second.lock())
+                return drawable;
+        }
+
+        auto drawable = create();
+
+        if (drawable == nullptr)
+            return nullptr;
+
+        if (std::size(svgs) + std::size(images) >= nextPruneSize)
+            removeExpiredDrawables();
+
+        map[key] = drawable;
+        return drawable;
+    }
+
+    DrawableStore::SharedDrawable DrawableStore::getSVG(const juce::String& svgSource)
+    {
+        return getOrCreate(svgs, svgSource, [&svgSource]() -> SharedDrawable {
+            return SvgCache::getInstance()->createDrawable(svgSource);
+        });
+    }
+
+    DrawableStore::SharedDrawable DrawableStore::getImage(const juce::Image& image)
+    {
+        const auto createDrawableImage = [&image]() -> SharedDrawable {
+            return std::make_shared<juce::DrawableImage>(image);
+        };
+
+        if (image.getPixelData() == nullptr)
+            return createDrawableImage();
+
+        return getOrCreate(images, image.getPixelData(), createDrawableImage);
+    }
+
+    int DrawableStore::getNumDrawables() const
+    {
+        const auto isLive = [](const auto& entry) {
+            return !entry.second.expired();
+        };
+
+        return static_cast<int>(std::count_if(std::begin(svgs), std::end(svgs), isLive)
+                                + std::count_if(std::begin(images), std::end(images), isLive));
+    }
+
+    void DrawableStore::removeExpiredDrawables()
+    {
+        const auto removeExpired = [](auto& map) {
+            for (auto entry = std::begin(map); entry != std::end(map);)
+            {
+                if (entry->second.expired())
+                    entry = map.erase(entry);
+                else
+                    entry++;
+            }
+        };
+
+        removeExpired(svgs);
+        removeExpired(images);
+
+        nextPruneSize = juce::jmax(minimumPruneSize, (std::size(svgs) + std::size(images)) * 2);
+    }
+
+    JUCE_IMPLEMENT_SINGLETON(DrawableStore)
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class DrawableStoreTest : public juce::UnitTest
+{
+public:
+    DrawableStoreTest()
+        : juce::UnitTest{ "jive::DrawableStore", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSVGs();
+        testImages();
+    }
+
+private:
+    void testSVGs()
+    {
+        beginTest("SVGs");
+
+        jive::DrawableStore store;
+        static constexpr auto svg = R"(<svg width="20" height="10"><rect width="20" height="10"/></svg>)";
+
+        {
+            const auto first = store.getSVG(svg);
+            const auto second = store.getSVG(svg);
+            expect(first != nullptr);
+            expect(first == second);
+            expectEquals(store.getNumDrawables(), 1);
+
+            const auto other = store.getSVG("<svg></svg>");
+            expect(other != first);
+            expectEquals(store.getNumDrawables(), 2);
+        }
+
+        expectEquals(store.getNumDrawables(), 0);
+        expect(store.getSVG("not svg") == nullptr);
+    }
+
+    void testImages()
+    {
+        beginTest("images");
+
+        jive::DrawableStore store;
+        const juce::Image image{ juce::Image::ARGB, 10, 10, true };
+
+        const auto first = store.getImage(image);
+        const auto second = store.getImage(juce::Image{ image });
+        expect(first == second);
+
+        const auto other = store.getImage(juce::Image{ juce::Image::ARGB, 10, 10, true });
+        expect(other != first);
+        expectEquals(store.getNumDrawables(), 2);
+    }
+};
+
+static DrawableStoreTest drawableStoreTest;
+#endif
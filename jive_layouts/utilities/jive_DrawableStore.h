@@ -0,0 +1,48 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace jive
+{
+    /** Interns the juce::Drawables held by jive::Drawable so that every
+        Drawable created from the same SVG source, or from the same
+        juce::Image, shares a single immutable instance.
+
+        Only weak references are held, so drawables are released as soon as
+        the last Drawable using them goes away.
+    */
+    class DrawableStore : private juce::DeletedAtShutdown
+    {
+    public:
+        using SharedDrawable = std::shared_ptr<juce::Drawable>;
+
+        DrawableStore() = default;
+        ~DrawableStore() override;
+
+        [[nodiscard]] SharedDrawable getSVG(const juce::String& svgSource);
+        [[nodiscard]] SharedDrawable getImage(const juce::Image& image);
+
+        [[nodiscard]] int getNumDrawables() const;
+
+        JUCE_DECLARE_SINGLETON(DrawableStore, false)
+
+    private:
+        struct SourceHash
+        {
+            [[nodiscard]] std::size_t operator()(const juce::String& source) const noexcept;
+        };
+
+        template <typename Map, typename Key, typename Factory>
+        [[nodiscard]] SharedDrawable getOrCreate(Map& map, const Key& key, Factory&& create);
+
+        void removeExpiredDrawables();
+
+        std::unordered_map<juce::String, std::weak_ptr<juce::Drawable>, SourceHash> svgs;
+        std::unordered_map<const juce::ImagePixelData*, std::weak_ptr<juce::Drawable>> images;
+        std::size_t nextPruneSize{ minimumPruneSize };
+
+        static constexpr std::size_t minimumPruneSize = 64;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DrawableStore)
+    };
+} // namespace jive
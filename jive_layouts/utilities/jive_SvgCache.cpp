@@ -0,0 +1,146 @@
+#include "jive_SvgCache.h"
+
+namespace jive
+{
+    std::size_t SvgCache::SourceHash::operator()(const juce::String& source) const noexcept
+    {
+        return static_cast<std::size_t>(source.hash());
+    }
+
+    SvgCache::~SvgCache()
+    {
+        clearSingletonInstance();
+    }
+
+    [[nodiscard]] static std::unique_ptr<juce::Drawable> parseSVG(const juce::String& svgSource)
+    {
+        if (const auto xml = juce::parseXML(svgSource))
+            return juce::Drawable::createFromSVG(*xml);
+
+        return nullptr;
+    }
+
+    std::unique_ptr<juce::Drawable> SvgCache::createDrawable(const juce::String& svgSource)
+    {
+        if (maximumNumDrawables <= 0)
+            return parseSVG(svgSource);
+
+        if (const auto existing = index.find(svgSource);
+            existing != std::end(index))
+        {
+            entries.splice(std::begin(entries), entries, existing->second);
+        }
+        else
+        {
+            entries.push_front(Entry{ svgSource, parseSVG(svgSource) });
+            index[svgSource] = std::begin(entries);
+            evictUntilWithin(maximumNumDrawables);
+        }
+
+        if (const auto& drawable = entries.front().drawable)
+            return drawable->createCopy();
+
+        return nullptr;
+    }
+
+    int SvgCache::getMaximumNumDrawables() const
+    {
+        return maximumNumDrawables;
+    }
+
+    void SvgCache::setMaximumNumDrawables(int newMaximum)
+    {
+        maximumNumDrawables = newMaximum;
+        evictUntilWithin(maximumNumDrawables);
+    }
+
+    int SvgCache::getNumCachedDrawables() const
+    {
+        return static_cast<int>(std::size(entries));
+    }
+
+    void SvgCache::clear()
+    {
+        evictUntilWithin(0);
+    }
+
+    void SvgCache::evictUntilWithin(int maximum)
+    {
+        while (getNumCachedDrawables() > juce::jmax(0, maximum))
+        {
+            index.erase(entries.back().source);
+            entries.pop_back();
+        }
+    }
+
+    JUCE_IMPLEMENT_SINGLETON(SvgCache)
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class SvgCacheTest : public juce::UnitTest
+{
+public:
+    SvgCacheTest()
+        : juce::UnitTest{ "jive::SvgCache", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCaching();
+        testEviction();
+        testInvalidSource();
+    }
+
+private:
+    static constexpr auto svg = R"(<svg width="20" height="10"><rect width="20" height="10" fill="red"/></svg>)";
+
+    void testCaching()
+    {
+        beginTest("caching");
+
+        jive::SvgCache cache;
+        const auto first = cache.createDrawable(svg);
+        expect(first != nullptr);
+        expectEquals(cache.getNumCachedDrawables(), 1);
+
+        const auto second = cache.createDrawable(svg);
+        expect(second != nullptr);
+        expect(second != first);
+        expectEquals(second->getDrawableBounds(), first->getDrawableBounds());
+        expectEquals(cache.getNumCachedDrawables(), 1);
+
+        [[maybe_unused]] const auto third = cache.createDrawable("<svg></svg>");
+        expectEquals(cache.getNumCachedDrawables(), 2);
+    }
+
+    void testEviction()
+    {
+        beginTest("eviction");
+
+        jive::SvgCache cache;
+        cache.setMaximumNumDrawables(2);
+
+        [[maybe_unused]] const auto a = cache.createDrawable("<svg width=\"1\"></svg>");
+        [[maybe_unused]] const auto b = cache.createDrawable("<svg width=\"2\"></svg>");
+        [[maybe_unused]] const auto c = cache.createDrawable("<svg width=\"3\"></svg>");
+        expectEquals(cache.getNumCachedDrawables(), 2);
+
+        cache.setMaximumNumDrawables(0);
+        expectEquals(cache.getNumCachedDrawables(), 0);
+        expect(cache.createDrawable(svg) != nullptr);
+        expectEquals(cache.getNumCachedDrawables(), 0);
+    }
+
+    void testInvalidSource()
+    {
+        beginTest("invalid source");
+
+        jive::SvgCache cache;
+        expect(cache.createDrawable("not svg") == nullptr);
+        expect(cache.createDrawable("not svg") == nullptr);
+    }
+};
+
+static SvgCacheTest svgCacheTest;
+#endif
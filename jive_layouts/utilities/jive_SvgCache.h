@@ -0,0 +1,57 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <list>
+
+namespace jive
+{
+    /** A process-wide cache of parsed SVG documents, keyed by their source.
+
+        Parsing SVG markup and building a juce::Drawable from it is far more
+        expensive than copying an already-built Drawable, so each distinct
+        source is only parsed once while it stays among the most recently
+        used sources.
+    */
+    class SvgCache : private juce::DeletedAtShutdown
+    {
+    public:
+        SvgCache() = default;
+        ~SvgCache() override;
+
+        /** Returns a new copy of the drawable described by the given SVG
+            source, or nullptr if it couldn't be parsed.
+        */
+        [[nodiscard]] std::unique_ptr<juce::Drawable> createDrawable(const juce::String& svgSource);
+
+        [[nodiscard]] int getMaximumNumDrawables() const;
+        void setMaximumNumDrawables(int newMaximum);
+
+        [[nodiscard]] int getNumCachedDrawables() const;
+        void clear();
+
+        static constexpr int defaultMaximumNumDrawables = 256;
+
+        JUCE_DECLARE_SINGLETON(SvgCache, false)
+
+    private:
+        struct SourceHash
+        {
+            [[nodiscard]] std::size_t operator()(const juce::String& source) const noexcept;
+        };
+
+        struct Entry
+        {
+            juce::String source;
+            std::unique_ptr<const juce::Drawable> drawable;
+        };
+
+        void evictUntilWithin(int maximum);
+
+        std::list<Entry> entries;
+        std::unordered_map<juce::String, std::list<Entry>::iterator, SourceHash> index;
+        int maximumNumDrawables{ defaultMaximumNumDrawables };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SvgCache)
+    };
+} // namespace jive
@@ -4,6 +4,12 @@
 
 namespace jive
 {
+    /** Identifies the selectors a style applies to.
+
+        The id, class name and type are interned identifiers, so comparing
+        and hashing them doesn't touch their strings. A null identifier
+        matches anything.
+    */
     struct StyleIdentifier
     {
         [[nodiscard]] auto operator==(const StyleIdentifier& other) const noexcept
@@ -17,9 +23,9 @@ namespace jive
                 && toggled == other.toggled;
         }
 
-        juce::String id;
-        juce::String className;
-        juce::String type;
+        juce::Identifier id;
+        juce::Identifier className;
+        juce::Identifier type;
         bool enabled = true;
         ComponentInteractionState::Keyboard keyboard;
         ComponentInteractionState::Mouse mouse;
@@ -34,14 +40,13 @@ namespace std
     {
         [[nodiscard]] auto operator()(const jive::StyleIdentifier& styleID) const noexcept
         {
-            return (styleID.id
-                    + styleID.className
-                    + styleID.type
-                    + juce::String{ styleID.enabled ? "enabled" : "disabled" }
-                    + juce::String{ static_cast<int>(styleID.keyboard) }
-                    + juce::String{ static_cast<int>(styleID.mouse) }
-                    + juce::String{ styleID.toggled ? "checked" : "unchecked" })
-                .hash();
+            return jive::hashAll(styleID.id,
+                                 styleID.className,
+                                 styleID.type,
+                                 styleID.enabled,
+                                 static_cast<int>(styleID.keyboard),
+                                 static_cast<int>(styleID.mouse),
+                                 styleID.toggled);
         }
     };
 } // namespace std
@@ -6,30 +6,48 @@
 
 namespace jive
 {
-    struct StyleSelectors
+    struct StyleSelectors : private juce::ValueTree::Listener
     {
     public:
         explicit StyleSelectors(const juce::ValueTree& sourceState)
             : state{ sourceState }
-            , id{ state, "id" }
-            , classes{ state, "class" }
+            , id{ state, idID }
+            , classes{ state, classID }
             , enabled{ state, "enabled" }
             , mouse{ state, "mouse" }
             , keyboard{ state, "keyboard" }
             , toggled{ state, "toggled" }
+            , dispatcher{ PropertyDispatcher::getFor(state) }
         {
+            internSelectors();
+
+            // Properties ignore removals, but removing an id or a class has
+            // to be seen so that styles for it stop matching
+            if (dispatcher != nullptr)
+            {
+                dispatcher->addListener(idID, *this);
+                dispatcher->addListener(classID, *this);
+            }
+
             const auto informListeners = [this]() {
                 if (onChange != nullptr)
                     onChange();
             };
-            id.onValueChange = informListeners;
             enabled.onValueChange = informListeners;
             mouse.onValueChange = informListeners;
             keyboard.onValueChange = informListeners;
-            classes.onValueChange = informListeners;
             toggled.onValueChange = informListeners;
         }
 
+        ~StyleSelectors() override
+        {
+            if (dispatcher != nullptr)
+            {
+                dispatcher->removeListener(idID, *this);
+                dispatcher->removeListener(classID, *this);
+            }
+        }
+
         template <typename PropertyType>
         [[nodiscard]] const PropertyType* findStyle(const std::unordered_map<StyleIdentifier, PropertyType>& styles) const
         {
@@ -41,19 +59,19 @@ namespace jive
             entries.erase(std::remove_if(std::begin(entries),
                                          std::end(entries),
                                          [this](auto&& entry) {
-                                             return entry->first.id.isNotEmpty() && entry->first.id != id.toString();
+                                             return entry->first.id.isValid() && entry->first.id != internedID;
                                          }),
                           std::end(entries));
             entries.erase(std::remove_if(std::begin(entries),
                                          std::end(entries),
                                          [this](auto&& entry) {
-                                             return entry->first.className.isNotEmpty() && !classes.get().contains(entry->first.className);
+                                             return entry->first.className.isValid() && !hasClass(entry->first.className);
                                          }),
                           std::end(entries));
             entries.erase(std::remove_if(std::begin(entries),
                                          std::end(entries),
                                          [this](auto&& entry) {
-                                             return entry->first.type.isNotEmpty() && entry->first.type != state.getType().toString();
+                                             return entry->first.type.isValid() && entry->first.type != state.getType();
                                          }),
                           std::end(entries));
             entries.erase(std::remove_if(std::begin(entries),
@@ -72,11 +90,6 @@ namespace jive
             entries.erase(std::remove_if(std::begin(entries),
                                          std::end(entries),
                                          [this](auto&& entry) {
-                                             if (mouse.get() == ComponentInteractionState::Mouse::active)
-                                             {
-                                                 [[maybe_unused]] auto x = 12;
-                                             }
-
                                              switch (entry->first.mouse)
                                              {
                                              case ComponentInteractionState::Mouse::dissociate:
@@ -110,15 +123,70 @@ namespace jive
         }
 
         const juce::ValueTree state;
-        const Property<juce::String> id;
-        const Property<juce::StringArray> classes;
+        const Property<juce::String,
+                       Inheritance::doNotInherit,
+                       Accumulation::doNotAccumulate,
+                       false,
+                       Responsiveness::ignoreChanges>
+            id;
+        const Property<juce::StringArray,
+                       Inheritance::doNotInherit,
+                       Accumulation::doNotAccumulate,
+                       false,
+                       Responsiveness::ignoreChanges>
+            classes;
         const Property<bool> enabled;
         const Property<ComponentInteractionState::Mouse> mouse;
         const Property<ComponentInteractionState::Keyboard> keyboard;
         const Property<bool> toggled;
         std::function<void()> onChange = nullptr;
 
+        // The id and classes, interned when they're set or removed so that
+        // matching them against styles only compares identifiers
+        juce::Identifier internedID;
+        std::vector<juce::Identifier> internedClasses;
+
     private:
+        void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& property) final
+        {
+            if (treeWhosePropertyChanged != state)
+                return;
+            if (property != idID && property != classID)
+                return;
+
+            internSelectors();
+
+            if (onChange != nullptr)
+                onChange();
+        }
+
+        [[nodiscard]] static juce::Identifier intern(const juce::String& name)
+        {
+            if (name.isEmpty())
+                return {};
+
+            return name;
+        }
+
+        void internSelectors()
+        {
+            internedID = intern(id.toString());
+
+            internedClasses.clear();
+
+            for (const auto& className : classes.get())
+            {
+                if (const auto interned = intern(className); interned.isValid())
+                    internedClasses.push_back(interned);
+            }
+        }
+
+        [[nodiscard]] bool hasClass(const juce::Identifier& className) const
+        {
+            return std::find(std::begin(internedClasses), std::end(internedClasses), className) != std::end(internedClasses);
+        }
+
         template <typename Container>
         [[nodiscard]] static auto collectIterators(const Container& container)
         {
@@ -144,10 +212,17 @@ namespace jive
                 .set(bit++, styleID.mouse == mouse.get())
                 .set(bit++, styleID.keyboard == keyboard.get())
                 .set(bit++, !styleID.enabled && !enabled.getOr(true))
-                .set(bit++, styleID.type == state.getType().toString())
-                .set(bit++, classes.get().contains(styleID.className))
-                .set(bit++, styleID.id == id.toString())
+                .set(bit++, styleID.type == state.getType())
+                .set(bit++, hasClass(styleID.className))
+                .set(bit++, styleID.id == internedID)
                 .to_ulong();
         }
+
+        static inline const juce::Identifier idID{ "id" };
+        static inline const juce::Identifier classID{ "class" };
+
+        std::shared_ptr<PropertyDispatcher> dispatcher;
+
+        JUCE_DECLARE_NON_COPYABLE(StyleSelectors)
     };
 } // namespace jive
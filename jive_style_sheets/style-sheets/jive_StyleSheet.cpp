@@ -21,6 +21,7 @@ namespace jive
     {
         jassert(component != nullptr);
         jassert(!component->getProperties().contains("style-sheet"));
+        JIVE_INSTRUMENT(styleSheetsCreated, 1);
 
         component->getProperties().set("style-sheet", this);
         component->addAndMakeVisible(backgroundCanvas, 0);
@@ -34,7 +35,7 @@ namespace jive
             updateStyles();
         };
         selectors.onChange = [this] {
-            applyStyles();
+            applyStylesWhenReady();
         };
 
         const auto updateBorderWidth = [this] {
@@ -48,6 +49,9 @@ namespace jive
 
     StyleSheet::~StyleSheet()
     {
+        JIVE_INSTRUMENT(styleSheetsDestroyed, 1);
+        PropertyTransaction::cancel(this);
+
         if (component != nullptr)
         {
             component->removeComponentListener(this);
@@ -58,6 +62,16 @@ namespace jive
             closestAncestor->dependants.removeAllInstancesOf(this);
     }
 
+    void* StyleSheet::operator new(std::size_t size)
+    {
+        return BlockPool::getItemPool().allocate(size);
+    }
+
+    void StyleSheet::operator delete(void* block, std::size_t size) noexcept
+    {
+        BlockPool::getItemPool().deallocate(block, size);
+    }
+
     Fill StyleSheet::getBackground() const
     {
         if (auto* background = selectors.findStyle(backgroundStyles))
@@ -127,25 +141,29 @@ namespace jive
 
     juce::Font StyleSheet::getFont() const
     {
-        juce::Font font{
-#if JUCE_MAJOR_VERSION >= 8
-            juce::FontOptions{},
-#endif
-        };
-
-        font.setTypefaceName(getFontFamily());
-
-        if (juce::Font::getDefaultTypefaceForFont(font) == nullptr)
-            return font;
+        FontCache::Descriptor descriptor;
+        descriptor.family = getFontFamily();
+        descriptor.pointHeight = getFontSize();
+        descriptor.letterSpacing = getLetterSpacing();
+        descriptor.stretch = getFontStretch();
+        descriptor.italic = getFontStyle() == "italic";
+        descriptor.bold = getFontWeight() == "bold";
+        descriptor.underlined = getTextDecoration() == "underlined";
+
+        return FontCache::getInstance()->getFont(descriptor);
+    }
 
-        font.setItalic(getFontStyle() == "italic");
-        font.setBold(getFontWeight() == "bold");
-        font = font.withPointHeight(getFontSize());
-        font.setExtraKerningFactor(getLetterSpacing() / font.getHeight());
-        font.setUnderline(getTextDecoration() == "underlined");
-        font.setHorizontalScale(getFontStretch());
+    PerformanceCounters StyleSheet::getPerformanceCounters() const
+    {
+        auto counters = performanceCounters;
+        counters += backgroundCanvas.getPerformanceCounters();
+        return counters;
+    }
 
-        return font;
+    void StyleSheet::resetPerformanceCounters()
+    {
+        performanceCounters.reset();
+        backgroundCanvas.resetPerformanceCounters();
     }
 
     void StyleSheet::componentParentHierarchyChanged(juce::Component& comp)
@@ -312,9 +330,10 @@ namespace jive
             {
                 styles.insert(std::make_pair(styleID, PropertyType{ &source, styleProperty }));
                 styles.at(styleID).onValueChange = [this] {
-                    applyStyles();
+                    applyStylesWhenReady();
                 };
                 styles.at(styleID).onTransitionProgressed = [this] {
+                    performanceCounters.countTransitionTick();
                     applyStyles();
                 };
             }
@@ -341,15 +360,15 @@ namespace jive
             }
         };
 
-        if (selectors.id.exists())
+        if (selectors.internedID.isValid())
         {
-            appendNestedStyles(selectors.id.toString(),
+            appendNestedStyles(selectors.internedID,
                                [&](auto& newID) {
-                                   newID.id = selectors.id.get();
+                                   newID.id = selectors.internedID;
                                });
         }
 
-        for (const auto& className : selectors.classes.get())
+        for (const auto& className : selectors.internedClasses)
         {
             appendNestedStyles(className,
                                [&](auto& newID) {
@@ -357,9 +376,9 @@ namespace jive
                                });
         }
 
-        appendNestedStyles(selectors.state.getType().toString(),
+        appendNestedStyles(selectors.state.getType(),
                            [&](auto& newID) {
-                               newID.type = selectors.state.getType().toString();
+                               newID.type = selectors.state.getType();
                            });
         appendNestedStyles("disabled",
                            [&](auto& newID) {
@@ -402,6 +421,7 @@ namespace jive
             updateStyles(*styleState, StyleIdentifier{});
 
             const auto onTransitionProgressed = [this] {
+                performanceCounters.countTransitionTick();
                 applyStyles();
             };
 
@@ -439,6 +459,9 @@ namespace jive
 
     void StyleSheet::applyStyles()
     {
+        JIVE_PROFILE_TREE_SCOPE("StyleSheet::applyStyles", state);
+        performanceCounters.countStyleApplication();
+
         backgroundCanvas.setFill(getBackground());
         backgroundCanvas.setBorderFill(getBorderFill());
         backgroundCanvas.setBorderRadii(getBorderRadii());
@@ -453,7 +476,7 @@ namespace jive
             text->setTextColour(foreground.getColour().value_or(juce::Colours::hotpink));
             text->setFont(getFont());
         }
-        if (state.getType().toString().compareIgnoreCase("svg") == 0)
+        if (state.getType().getCharPointer().compareIgnoreCase(juce::CharPointer_ASCII{ "svg" }) == 0)
         {
             state.setProperty("fill",
                               "#" + foreground.getColour()->toDisplayString(false),
@@ -463,6 +486,18 @@ namespace jive
         for (auto* dependant : dependants)
             dependant->applyStyles();
     }
+
+    void StyleSheet::applyStylesWhenReady()
+    {
+        // Several selectors or styles often change at once, e.g. while a view
+        // is being built, so only apply the styles once they've all been set
+        const auto deferred = PropertyTransaction::deferUntilComplete(state, this, [this] {
+            applyStyles();
+        });
+
+        if (!deferred)
+            applyStyles();
+    }
 } // namespace jive
 
 #if JIVE_UNIT_TESTS
@@ -612,6 +647,38 @@ private:
             expect(findCanvas(component)->getFill() == jive::Fill{ juce::Colour{ 0xFF333333 } }
                    || findCanvas(component)->getFill() == jive::Fill{ juce::Colour{ 0xFF666666 } });
         }
+
+        beginTest("finding styles locally / ids, classes and types");
+        {
+            juce::Component component;
+            juce::ValueTree state{
+                "Button",
+                {
+                    { "id", "ok" },
+                    { "class", "primary large" },
+                    {
+                        "style",
+                        new jive::Object{
+                            { "background", "#111111" },
+                            { "Button", new jive::Object{ { "background", "#222222" } } },
+                            { "primary", new jive::Object{ { "background", "#333333" } } },
+                            { "ok", new jive::Object{ { "background", "#444444" } } },
+                        },
+                    },
+                },
+            };
+            const auto styleSheet = jive::StyleSheet::create(component, state);
+            expectEquals(styleSheet->getBackground(),
+                         jive::Fill{ juce::Colour{ 0xFF444444 } });
+
+            state.removeProperty("id", nullptr);
+            expectEquals(styleSheet->getBackground(),
+                         jive::Fill{ juce::Colour{ 0xFF333333 } });
+
+            state.setProperty("class", "secondary", nullptr);
+            expectEquals(styleSheet->getBackground(),
+                         jive::Fill{ juce::Colour{ 0xFF222222 } });
+        }
     }
 
     void testFindingStylesInParentStyleSheets()
@@ -18,12 +18,23 @@ namespace jive
 
         ~StyleSheet();
 
+        // Allocated from the same pool as the GUI items they belong to
+        [[nodiscard]] static void* operator new(std::size_t size);
+        static void operator delete(void* block, std::size_t size) noexcept;
+
         [[nodiscard]] Fill getBackground() const;
         [[nodiscard]] Fill getForeground() const;
         [[nodiscard]] Fill getBorderFill() const;
         [[nodiscard]] BorderRadii<float> getBorderRadii() const;
         [[nodiscard]] juce::Font getFont() const;
 
+        /** Returns how often this style sheet's styles were applied and its
+            transitions ticked, along with how often its background canvas
+            was painted.
+        */
+        [[nodiscard]] PerformanceCounters getPerformanceCounters() const;
+        void resetPerformanceCounters();
+
         [[nodiscard]] static ReferenceCountedPointer create(juce::Component& component, juce::ValueTree state);
 
     private:
@@ -44,6 +55,7 @@ namespace jive
         void updateStyles(jive::Object& state, StyleIdentifier);
         void updateStyles();
         void applyStyles();
+        void applyStylesWhenReady();
 
         BackgroundCanvas backgroundCanvas;
 
@@ -83,6 +95,8 @@ namespace jive
         std::unique_ptr<Property<float>> calculatedFontStretch;
         std::unique_ptr<Property<float>> calculatedLetterSpacing;
 
+        PerformanceCounters performanceCounters;
+
         JUCE_LEAK_DETECTOR(StyleSheet)
     };
 } // namespace jive
@@ -0,0 +1,103 @@
+#include "AllocationCounting.h"
+
+#if JIVE_INSTRUMENTATION
+// Replaces the global allocation functions so that jive::Instrumentation can
+// report how many heap allocations each benchmark iteration makes, and how
+// many bytes stay allocated.
+//
+// Each block is prefixed with its size so that deallocations can report how
+// many bytes they free, and the peak number of live bytes can be tracked.
+
+static constexpr auto allocationHeaderSize = alignof(std::max_align_t);
+
+static std::atomic<juce::int64> liveBytes{ 0 };
+static std::atomic<juce::int64> peakLiveBytes{ 0 };
+static std::atomic<juce::int64> liveBytesAtReset{ 0 };
+
+static void addLiveBytes(juce::int64 amount) noexcept
+{
+    const auto live = liveBytes.fetch_add(amount, std::memory_order_relaxed) + amount;
+    auto peak = peakLiveBytes.load(std::memory_order_relaxed);
+
+    while (live > peak && !peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    JIVE_INSTRUMENT(allocations, 1);
+    JIVE_INSTRUMENT(allocatedBytes, size);
+    addLiveBytes(static_cast<juce::int64>(size));
+
+    if (auto* const block = static_cast<char*>(std::malloc(allocationHeaderSize + size)))
+    {
+        *reinterpret_cast<std::size_t*>(block) = size;
+        return block + allocationHeaderSize;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer == nullptr)
+        return;
+
+    auto* const block = static_cast<char*>(pointer) - allocationHeaderSize;
+
+    const auto size = *reinterpret_cast<const std::size_t*>(block);
+
+    JIVE_INSTRUMENT(deallocations, 1);
+    JIVE_INSTRUMENT(deallocatedBytes, size);
+    addLiveBytes(-static_cast<juce::int64>(size));
+    std::free(block);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+namespace allocation_counting
+{
+    void resetPeakLiveBytes() noexcept
+    {
+        const auto live = liveBytes.load(std::memory_order_relaxed);
+        liveBytesAtReset.store(live, std::memory_order_relaxed);
+        peakLiveBytes.store(live, std::memory_order_relaxed);
+    }
+
+    juce::int64 getPeakLiveBytes() noexcept
+    {
+        return peakLiveBytes.load(std::memory_order_relaxed) - liveBytesAtReset.load(std::memory_order_relaxed);
+    }
+} // namespace allocation_counting
+#else
+namespace allocation_counting
+{
+    void resetPeakLiveBytes() noexcept
+    {
+    }
+
+    juce::int64 getPeakLiveBytes() noexcept
+    {
+        return 0;
+    }
+} // namespace allocation_counting
+#endif
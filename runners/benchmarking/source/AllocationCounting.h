@@ -0,0 +1,22 @@
+#pragma once
+
+#include <jive_core/jive_core.h>
+
+/** The high-water mark of the bytes allocated on the heap, tracked by the
+    allocation functions in AllocationCounting.cpp.
+
+    Always returns 0 unless JIVE_INSTRUMENTATION is enabled.
+*/
+namespace allocation_counting
+{
+    /** Starts tracking a new peak from the number of bytes currently
+        allocated.
+    */
+    void resetPeakLiveBytes() noexcept;
+
+    /** Returns the most bytes that have been allocated at once since
+        resetPeakLiveBytes() was last called, less the bytes that were
+        already allocated at that point.
+    */
+    [[nodiscard]] juce::int64 getPeakLiveBytes() noexcept;
+} // namespace allocation_counting
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <jive_layouts/jive_layouts.h>
+#include "BenchmarkResult.h"
 
 class Benchmark
 {
@@ -18,18 +18,43 @@ public:
     {
     }
 
-    void run()
+    virtual ~Benchmark() = default;
+
+    void setNumWarmUpIterations(int numIterations)
+    {
+        warmUpIterations = juce::jmax(0, numIterations);
+    }
+
+    [[nodiscard]] const juce::String& getDescription() const
+    {
+        return description;
+    }
+
+    BenchmarkResult run()
     {
         std::cout << "Test:       " << description << "\n";
 
+        jive::Interpreter interpreter;
+        doWarmUp(interpreter);
+
+        std::vector<double> samples;
+
         if (duration.has_value())
-            doTimeboxedRun();
+            doTimeboxedRun(interpreter, samples);
         if (iterations.has_value())
-            doIterativeRun();
+            doIterativeRun(interpreter, samples);
+
+        auto result = BenchmarkResult::fromSamples(description, warmUpIterations, std::move(samples));
+        addCounters(result);
+        printResult(result);
 
         std::cout << juce::String::repeatedString(juce::CharPointer_UTF8{ "\xe2\x95\x90" }, columnWidth) << "\n\n";
+
+        return result;
     }
 
+    static constexpr int defaultNumWarmUpIterations = 10;
+
 protected:
     virtual void doIteration(jive::Interpreter& interpreter) = 0;
 
@@ -39,55 +64,96 @@ private:
         std::cout << "\r" << jive::buildProgressBar(progressNormalised, columnWidth) << std::flush;
     }
 
-    void printResult(int counter, juce::RelativeTime elapsed)
+    void printResult(const BenchmarkResult& result)
     {
         std::cout << "\n\n"
-                  << "Completed:  " << counter << " iterations\n"
-                  << "Average:    " << static_cast<double>(elapsed.inMilliseconds()) / static_cast<double>(counter) << "ms\n\n";
+                  << "Completed:  " << result.iterations << " iterations\n"
+                  << "Mean:       " << result.meanMs << "ms\n"
+                  << "Min:        " << result.minMs << "ms\n"
+                  << "Median:     " << result.medianMs << "ms\n"
+                  << "p95:        " << result.p95Ms << "ms\n"
+                  << "p99:        " << result.p99Ms << "ms\n"
+                  << "Std. dev.:  " << result.stddevMs << "ms\n\n";
+
+        for (const auto& [counterName, perIteration] : result.counters)
+            std::cout << "    " << counterName << ": " << perIteration << " per iteration\n";
+
+        if (!result.counters.empty())
+            std::cout << "\n";
+    }
+
+    void addCounters(BenchmarkResult& result) const
+    {
+        if (!jive::Instrumentation::isEnabled || result.iterations == 0)
+            return;
+
+        for (std::size_t i = 0; i < jive::Instrumentation::numCounters; i++)
+        {
+            const auto counter = static_cast<jive::Instrumentation::Counter>(i);
+            result.counters.emplace_back(jive::Instrumentation::getName(counter),
+                                         static_cast<double>(counterTotals[i]) / static_cast<double>(result.iterations));
+        }
     }
 
-    void doTimeboxedRun()
+    [[nodiscard]] double timeIteration(jive::Interpreter& interpreter)
+    {
+        const auto countersBefore = jive::Instrumentation::takeSnapshot();
+        const auto start = juce::Time::getHighResolutionTicks();
+        doIteration(interpreter);
+        const auto end = juce::Time::getHighResolutionTicks();
+        const auto countersAfter = jive::Instrumentation::takeSnapshot();
+
+        for (std::size_t i = 0; i < jive::Instrumentation::numCounters; i++)
+            counterTotals[i] += countersAfter[i] - countersBefore[i];
+
+        return juce::Time::highResolutionTicksToSeconds(end - start) * 1000.0;
+    }
+
+    void doWarmUp(jive::Interpreter& interpreter)
+    {
+        std::cout << "Warm-up:    " << warmUpIterations << " iterations\n";
+
+        for (auto i = 0; i < warmUpIterations; i++)
+            doIteration(interpreter);
+    }
+
+    void doTimeboxedRun(jive::Interpreter& interpreter, std::vector<double>& samples)
     {
         std::cout << "Duration:   " << duration->getDescription() << "\n\n";
 
-        jive::Interpreter interpreter;
-        auto counter = 0;
-        const auto start = juce::Time::getCurrentTime();
+        const auto durationTicks = juce::Time::secondsToHighResolutionTicks(duration->inSeconds());
+        const auto start = juce::Time::getHighResolutionTicks();
 
-        for (auto elapsed = juce::Time::getCurrentTime() - start;
-             elapsed <= duration.value();
-             elapsed = juce::Time::getCurrentTime() - start)
+        for (auto elapsed = juce::int64{ 0 };
+             elapsed <= durationTicks;
+             elapsed = juce::Time::getHighResolutionTicks() - start)
         {
-            doIteration(interpreter);
-            counter++;
-            printProgress(elapsed.inSeconds() / duration->inSeconds());
+            samples.push_back(timeIteration(interpreter));
+            printProgress(static_cast<double>(elapsed) / static_cast<double>(durationTicks));
         }
 
         printProgress(1.0);
-        printResult(counter, *duration);
     }
 
-    void doIterativeRun()
+    void doIterativeRun(jive::Interpreter& interpreter, std::vector<double>& samples)
     {
         std::cout << "Iterations: " << *iterations << "\n";
 
-        jive::Interpreter interpreter;
-        const auto start = juce::Time::getCurrentTime();
+        samples.reserve(std::size(samples) + static_cast<std::size_t>(*iterations));
 
         for (auto i = 0; i < *iterations;)
         {
-            doIteration(interpreter);
+            samples.push_back(timeIteration(interpreter));
             i++;
             printProgress(i / static_cast<double>(*iterations));
         }
-
-        const auto elapsed = juce::Time::getCurrentTime() - start;
-        printResult(*iterations, elapsed);
     }
 
     const juce::String description;
     const std::optional<juce::RelativeTime> duration;
     const std::optional<int> iterations;
+    int warmUpIterations{ defaultNumWarmUpIterations };
+    jive::Instrumentation::Snapshot counterTotals{};
 
     static constexpr int columnWidth = 50;
 };
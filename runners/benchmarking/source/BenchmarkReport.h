@@ -0,0 +1,148 @@
+#pragma once
+
+#include "BenchmarkResult.h"
+
+class BenchmarkReport
+{
+public:
+    void add(BenchmarkResult result)
+    {
+        results.push_back(std::move(result));
+    }
+
+    [[nodiscard]] const std::vector<BenchmarkResult>& getResults() const
+    {
+        return results;
+    }
+
+    [[nodiscard]] const BenchmarkResult* find(const juce::String& name) const
+    {
+        const auto result = std::find_if(std::begin(results),
+                                         std::end(results),
+                                         [&name](const auto& r) {
+                                             return r.name == name;
+                                         });
+
+        return result != std::end(results) ? &(*result) : nullptr;
+    }
+
+    [[nodiscard]] juce::String toJSON() const
+    {
+        juce::Array<juce::var> benchmarks;
+
+        for (const auto& result : results)
+            benchmarks.add(result.toVar());
+
+        auto object = std::make_unique<juce::DynamicObject>();
+        object->setProperty("version", formatVersion);
+        object->setProperty("date", juce::Time::getCurrentTime().toISO8601(true));
+        object->setProperty("benchmarks", benchmarks);
+
+        return juce::JSON::toString(juce::var{ object.release() });
+    }
+
+    [[nodiscard]] juce::String toCSV() const
+    {
+        juce::StringArray lines{ results.empty() ? BenchmarkResult{}.getCSVHeader() : results.front().getCSVHeader() };
+
+        for (const auto& result : results)
+            lines.add(result.toCSVRow());
+
+        return lines.joinIntoString("\n") + "\n";
+    }
+
+    [[nodiscard]] static std::optional<BenchmarkReport> readFrom(const juce::File& file)
+    {
+        const auto json = juce::JSON::parse(file);
+
+        if (const auto* benchmarks = json.getProperty("benchmarks", {}).getArray())
+        {
+            BenchmarkReport report;
+
+            for (const auto& benchmark : *benchmarks)
+            {
+                if (auto result = BenchmarkResult::fromVar(benchmark))
+                    report.add(std::move(*result));
+            }
+
+            return report;
+        }
+
+        return std::nullopt;
+    }
+
+    /** Prints the median of every benchmark in the current report next to
+        the baseline's, and returns the number of benchmarks whose median got
+        slower, or whose instrumentation counters grew, by more than the given
+        threshold.
+    */
+    [[nodiscard]] static int compare(const BenchmarkReport& baseline,
+                                     const BenchmarkReport& current,
+                                     double thresholdPercent)
+    {
+        auto numRegressions = 0;
+
+        std::cout << "Threshold:  " << thresholdPercent << "%\n\n";
+
+        for (const auto& result : current.getResults())
+        {
+            std::cout << result.name << "\n";
+
+            const auto* const previous = baseline.find(result.name);
+
+            if (previous == nullptr)
+            {
+                std::cout << "    median " << result.medianMs << "ms (no baseline)\n";
+                continue;
+            }
+
+            const auto change = getPercentageChange(previous->medianMs, result.medianMs);
+            auto isRegression = change > thresholdPercent;
+
+            std::cout << "    median " << previous->medianMs << "ms -> " << result.medianMs << "ms ("
+                      << (change >= 0.0 ? "+" : "") << juce::String{ change, 1 } << "%)"
+                      << (isRegression ? "  REGRESSION" : "") << "\n"
+                      << "    p99    " << previous->p99Ms << "ms -> " << result.p99Ms << "ms\n";
+
+            for (const auto& [counterName, perIteration] : result.counters)
+            {
+                const auto previousPerIteration = previous->getCounter(counterName);
+
+                if (!previousPerIteration.has_value())
+                    continue;
+
+                const auto counterChange = getPercentageChange(*previousPerIteration, perIteration);
+                const auto counterRegressed = counterChange > thresholdPercent;
+
+                if (counterRegressed || !juce::approximatelyEqual(*previousPerIteration, perIteration))
+                {
+                    std::cout << "    " << counterName << " " << *previousPerIteration << " -> " << perIteration
+                              << (counterRegressed ? "  REGRESSION" : "") << "\n";
+                }
+
+                isRegression = isRegression || counterRegressed;
+            }
+
+            if (isRegression)
+                numRegressions++;
+        }
+
+        std::cout << "\n"
+                  << numRegressions << " regression(s)\n";
+
+        return numRegressions;
+    }
+
+private:
+    [[nodiscard]] static double getPercentageChange(double previous, double current)
+    {
+        if (previous > 0.0)
+            return (current - previous) / previous * 100.0;
+
+        return current >= 1.0 ? 100.0 : 0.0;
+    }
+
+    std::vector<BenchmarkResult> results;
+
+    static constexpr int formatVersion = 1;
+};
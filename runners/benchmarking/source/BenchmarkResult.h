@@ -0,0 +1,167 @@
+#pragma once
+
+#include <jive_layouts/jive_layouts.h>
+
+struct BenchmarkResult
+{
+    [[nodiscard]] static BenchmarkResult fromSamples(const juce::String& benchmarkName,
+                                                     int numWarmUpIterations,
+                                                     std::vector<double> samplesMs)
+    {
+        BenchmarkResult result;
+        result.name = benchmarkName;
+        result.warmUpIterations = numWarmUpIterations;
+        result.iterations = static_cast<int>(std::size(samplesMs));
+
+        if (samplesMs.empty())
+            return result;
+
+        std::sort(std::begin(samplesMs), std::end(samplesMs));
+
+        result.totalMs = std::accumulate(std::begin(samplesMs), std::end(samplesMs), 0.0);
+        result.meanMs = result.totalMs / static_cast<double>(std::size(samplesMs));
+        result.minMs = samplesMs.front();
+        result.maxMs = samplesMs.back();
+        result.medianMs = getPercentile(samplesMs, 50.0);
+        result.p95Ms = getPercentile(samplesMs, 95.0);
+        result.p99Ms = getPercentile(samplesMs, 99.0);
+
+        if (std::size(samplesMs) > 1)
+        {
+            const auto sumOfSquares = std::accumulate(std::begin(samplesMs),
+                                                      std::end(samplesMs),
+                                                      0.0,
+                                                      [mean = result.meanMs](auto sum, auto sample) {
+                                                          return sum + (sample - mean) * (sample - mean);
+                                                      });
+            result.stddevMs = std::sqrt(sumOfSquares / static_cast<double>(std::size(samplesMs) - 1));
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] juce::var toVar() const
+    {
+        auto object = std::make_unique<juce::DynamicObject>();
+        object->setProperty("name", name);
+        object->setProperty("warm-up-iterations", warmUpIterations);
+        object->setProperty("iterations", iterations);
+        object->setProperty("total-ms", totalMs);
+        object->setProperty("mean-ms", meanMs);
+        object->setProperty("min-ms", minMs);
+        object->setProperty("max-ms", maxMs);
+        object->setProperty("median-ms", medianMs);
+        object->setProperty("p95-ms", p95Ms);
+        object->setProperty("p99-ms", p99Ms);
+        object->setProperty("stddev-ms", stddevMs);
+
+        if (!counters.empty())
+        {
+            auto countersObject = std::make_unique<juce::DynamicObject>();
+
+            for (const auto& [counterName, perIteration] : counters)
+                countersObject->setProperty(counterName, perIteration);
+
+            object->setProperty("counters-per-iteration", countersObject.release());
+        }
+
+        return object.release();
+    }
+
+    [[nodiscard]] static std::optional<BenchmarkResult> fromVar(const juce::var& value)
+    {
+        const auto* const object = value.getDynamicObject();
+
+        if (object == nullptr || !object->hasProperty("name"))
+            return std::nullopt;
+
+        BenchmarkResult result;
+        result.name = object->getProperty("name").toString();
+        result.warmUpIterations = object->getProperty("warm-up-iterations");
+        result.iterations = object->getProperty("iterations");
+        result.totalMs = object->getProperty("total-ms");
+        result.meanMs = object->getProperty("mean-ms");
+        result.minMs = object->getProperty("min-ms");
+        result.maxMs = object->getProperty("max-ms");
+        result.medianMs = object->getProperty("median-ms");
+        result.p95Ms = object->getProperty("p95-ms");
+        result.p99Ms = object->getProperty("p99-ms");
+        result.stddevMs = object->getProperty("stddev-ms");
+
+        if (const auto* countersObject = object->getProperty("counters-per-iteration").getDynamicObject())
+        {
+            for (const auto& counter : countersObject->getProperties())
+                result.counters.emplace_back(counter.name.toString(), static_cast<double>(counter.value));
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] juce::String getCSVHeader() const
+    {
+        juce::StringArray columns{ "name", "warm-up-iterations", "iterations", "total-ms", "mean-ms", "min-ms", "max-ms", "median-ms", "p95-ms", "p99-ms", "stddev-ms" };
+
+        for (const auto& counter : counters)
+            columns.add(counter.first);
+
+        return columns.joinIntoString(",");
+    }
+
+    [[nodiscard]] juce::String toCSVRow() const
+    {
+        juce::StringArray columns{
+            name.quoted(),
+            juce::String{ warmUpIterations },
+            juce::String{ iterations },
+            juce::String{ totalMs },
+            juce::String{ meanMs },
+            juce::String{ minMs },
+            juce::String{ maxMs },
+            juce::String{ medianMs },
+            juce::String{ p95Ms },
+            juce::String{ p99Ms },
+            juce::String{ stddevMs },
+        };
+
+        for (const auto& counter : counters)
+            columns.add(juce::String{ counter.second });
+
+        return columns.joinIntoString(",");
+    }
+
+    [[nodiscard]] std::optional<double> getCounter(const juce::String& counterName) const
+    {
+        for (const auto& [existingName, perIteration] : counters)
+        {
+            if (existingName == counterName)
+                return perIteration;
+        }
+
+        return std::nullopt;
+    }
+
+    juce::String name;
+    int warmUpIterations{ 0 };
+    int iterations{ 0 };
+    double totalMs{ 0.0 };
+    double meanMs{ 0.0 };
+    double minMs{ 0.0 };
+    double maxMs{ 0.0 };
+    double medianMs{ 0.0 };
+    double p95Ms{ 0.0 };
+    double p99Ms{ 0.0 };
+    double stddevMs{ 0.0 };
+
+    /** The average increase of every jive::Instrumentation counter per
+        measured iteration. Empty unless JIVE_INSTRUMENTATION is enabled.
+    */
+    std::vector<std::pair<juce::String, double>> counters;
+
+private:
+    [[nodiscard]] static double getPercentile(const std::vector<double>& sortedSamples, double percentile)
+    {
+        const auto rank = static_cast<int>(std::ceil(percentile / 100.0 * static_cast<double>(std::size(sortedSamples))));
+        const auto index = juce::jlimit(0, static_cast<int>(std::size(sortedSamples)) - 1, rank - 1);
+        return sortedSamples[static_cast<std::size_t>(index)];
+    }
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "BenchmarkResult.h"
+#include "ViewGenerators.h"
+
+/** Measures how much memory each GuiItem of an interpreted view keeps
+    allocated, so that the footprint of items and their Properties can be
+    compared between builds with --compare.
+
+    The heap is only measured when JIVE_INSTRUMENTATION is enabled, in which
+    case AllocationCounting.cpp counts the bytes allocated and freed while the
+    view is interpreted. The static size of a Property is always reported.
+*/
+class MemoryBenchmark
+{
+public:
+    MemoryBenchmark(juce::String benchmarkName, juce::ValueTree generatedView)
+        : name{ std::move(benchmarkName) }
+        , view{ generatedView }
+    {
+    }
+
+    BenchmarkResult run() const
+    {
+        std::cout << "Memory:     " << name << "\n\n";
+
+        jive::Interpreter interpreter;
+        const auto numItems = static_cast<double>(generators::countNodes(view));
+        const auto viewToInterpret = view.createCopy();
+
+        const auto countersBefore = jive::Instrumentation::takeSnapshot();
+        const auto start = juce::Time::getHighResolutionTicks();
+        const auto item = interpreter.interpret(viewToInterpret);
+        const auto end = juce::Time::getHighResolutionTicks();
+        const auto countersAfter = jive::Instrumentation::takeSnapshot();
+
+        const auto getChange = [&countersBefore, &countersAfter](jive::Instrumentation::Counter counter) {
+            const auto index = static_cast<std::size_t>(counter);
+            return static_cast<double>(countersAfter[index] - countersBefore[index]);
+        };
+
+        auto result = BenchmarkResult::fromSamples(name,
+                                                   0,
+                                                   { juce::Time::highResolutionTicksToSeconds(end - start) * 1000.0 });
+        result.counters.emplace_back("sizeof-property", static_cast<double>(sizeof(jive::Property<float>)));
+        result.counters.emplace_back("sizeof-length", static_cast<double>(sizeof(jive::Length)));
+
+        if (jive::Instrumentation::isEnabled)
+        {
+            using Counter = jive::Instrumentation::Counter;
+
+            const auto liveBytes = getChange(Counter::allocatedBytes) - getChange(Counter::deallocatedBytes);
+            const auto liveProperties = getChange(Counter::propertiesCreated) - getChange(Counter::propertiesDestroyed);
+
+            result.counters.emplace_back("bytes-per-item", liveBytes / numItems);
+            result.counters.emplace_back("allocations-per-item", getChange(Counter::allocations) / numItems);
+            result.counters.emplace_back("properties-per-item", liveProperties / numItems);
+        }
+
+        std::cout << "Items:      " << juce::roundToInt(numItems) << "\n";
+
+        for (const auto& [counterName, value] : result.counters)
+            std::cout << "    " << counterName << ": " << value << "\n";
+
+        std::cout << "\n";
+
+        return result;
+    }
+
+private:
+    const juce::String name;
+    const juce::ValueTree view;
+};
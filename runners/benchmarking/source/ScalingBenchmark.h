@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Benchmark.h"
+#include "BenchmarkReport.h"
+#include "ViewGenerators.h"
+
+/** Measures a single step of a generated view's lifetime. */
+class ScalingBenchmark : public Benchmark
+{
+public:
+    enum class Stage
+    {
+        /** Interprets a fresh copy of the generated view every iteration. */
+        interpretation,
+
+        /** Interprets the view once, then resizes it every iteration. */
+        layout,
+    };
+
+    ScalingBenchmark(const juce::String& sweepName,
+                     int scale,
+                     juce::ValueTree generatedView,
+                     Stage stageToMeasure)
+        : Benchmark{
+            sweepName + " [N=" + juce::String{ scale } + "]",
+            juce::RelativeTime::seconds(1.0),
+        }
+        , view{ generatedView }
+        , stage{ stageToMeasure }
+    {
+    }
+
+protected:
+    void doIteration(jive::Interpreter& interpreter) final
+    {
+        switch (stage)
+        {
+        case Stage::interpretation:
+        {
+            const auto interpretedItem = interpreter.interpret(view.createCopy());
+            break;
+        }
+        case Stage::layout:
+        {
+            if (item == nullptr)
+                item = interpreter.interpret(view);
+
+            view.setProperty("width", view["width"] == juce::var{ 1000 } ? 999 : 1000, nullptr);
+            break;
+        }
+        }
+    }
+
+private:
+    juce::ValueTree view;
+    const Stage stage;
+    std::unique_ptr<jive::GuiItem> item;
+};
+
+/** Runs a ScalingBenchmark for each scale in a sweep and prints how the
+    median time grows with the scale.
+
+    The growth exponent between neighbouring points is log(t2 / t1) /
+    log(n2 / n1): 1 means the cost grows linearly with N, and anything
+    noticeably above 1 is flagged as super-linear.
+*/
+class ScalingSweep
+{
+public:
+    using Generator = std::function<juce::ValueTree(int)>;
+
+    ScalingSweep(juce::String sweepName,
+                 std::vector<int> sweepScales,
+                 Generator viewGenerator,
+                 ScalingBenchmark::Stage stageToMeasure)
+        : name{ std::move(sweepName) }
+        , scales{ std::move(sweepScales) }
+        , generator{ std::move(viewGenerator) }
+        , stage{ stageToMeasure }
+    {
+    }
+
+    void run(BenchmarkReport& report, int warmUpIterations)
+    {
+        std::vector<std::pair<int, double>> curve;
+
+        for (const auto scale : scales)
+        {
+            ScalingBenchmark benchmark{ name, scale, generator(scale), stage };
+            benchmark.setNumWarmUpIterations(warmUpIterations);
+
+            auto result = benchmark.run();
+            curve.emplace_back(scale, result.medianMs);
+            report.add(std::move(result));
+        }
+
+        printCurve(curve);
+    }
+
+private:
+    void printCurve(const std::vector<std::pair<int, double>>& curve) const
+    {
+        std::cout << "Scaling:    " << name << "\n\n";
+
+        for (std::size_t i = 0; i < std::size(curve); i++)
+        {
+            const auto [scale, medianMs] = curve[i];
+            std::cout << "    N=" << juce::String{ scale }.paddedRight(' ', 8)
+                      << juce::String{ medianMs, 4 }.paddedLeft(' ', 12) << "ms"
+                      << juce::String{ medianMs * 1000.0 / scale, 3 }.paddedLeft(' ', 12) << "us/N";
+
+            if (i > 0)
+            {
+                const auto [previousScale, previousMedianMs] = curve[i - 1];
+                const auto exponent = previousMedianMs > 0.0 && medianMs > 0.0
+                                        ? std::log(medianMs / previousMedianMs) / std::log(static_cast<double>(scale) / previousScale)
+                                        : 0.0;
+
+                std::cout << "    exponent " << juce::String{ exponent, 2 }
+                          << (exponent > superLinearExponent ? "  SUPER-LINEAR" : "");
+            }
+
+            std::cout << "\n";
+        }
+
+        std::cout << "\n";
+    }
+
+    const juce::String name;
+    const std::vector<int> scales;
+    const Generator generator;
+    const ScalingBenchmark::Stage stage;
+
+    static constexpr auto superLinearExponent = 1.2;
+};
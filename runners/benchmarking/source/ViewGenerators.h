@@ -0,0 +1,327 @@
+#pragma once
+
+#include <jive_layouts/jive_layouts.h>
+
+/** Builders for synthetic views whose size is controlled by a few
+    parameters, so benchmarks can measure how JIVE's cost scales rather than
+    timing a single hand-written view.
+
+    All generators are deterministic - the same parameters always produce the
+    same tree - so results from different runs can be compared.
+*/
+namespace generators
+{
+    /** The relative number of flex, grid and block containers in a generated
+        tree. Containers cycle through the layouts in proportion to these
+        weights.
+    */
+    struct LayoutMix
+    {
+        [[nodiscard]] juce::String getDisplay(int index) const
+        {
+            const auto total = juce::jmax(1, flex + grid + block);
+            const auto slot = index % total;
+
+            if (slot < flex)
+                return "flex";
+            if (slot < flex + grid)
+                return "grid";
+
+            return "block";
+        }
+
+        int flex{ 1 };
+        int grid{ 0 };
+        int block{ 0 };
+    };
+
+    /** The relative number of each kind of selector in a generated style. */
+    struct SelectorMix
+    {
+        int properties{ 2 };
+        int states{ 1 };
+        int ids{ 1 };
+        int classes{ 1 };
+        int nested{ 1 };
+    };
+
+    [[nodiscard]] inline juce::String createText(int length)
+    {
+        static constexpr auto loremIpsum = "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ";
+        static const juce::String source{ loremIpsum };
+
+        juce::String text;
+        text.preallocateBytes(static_cast<std::size_t>(length));
+
+        while (text.length() < length)
+            text += source.substring(0, length - text.length());
+
+        return text;
+    }
+
+    [[nodiscard]] inline juce::String createColour(int index)
+    {
+        return "#" + juce::String::toHexString(0x102030 + index * 0x010305).paddedLeft('0', 6).getLastCharacters(6);
+    }
+
+    /** A tree of containers `depth` levels deep where every container has
+        `fanOut` children, and the leaves are fixed-size components.
+    */
+    [[nodiscard]] inline juce::ValueTree createNestedView(int depth, int fanOut, LayoutMix layouts = {})
+    {
+        auto containerIndex = 0;
+
+        std::function<juce::ValueTree(int)> createLevel = [&](int level) {
+            if (level >= depth)
+            {
+                return juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", 10 },
+                        { "height", 10 },
+                    },
+                };
+            }
+
+            const auto display = layouts.getDisplay(containerIndex++);
+            juce::ValueTree container{
+                "Component",
+                {
+                    { "display", display },
+                    { "flex-wrap", "wrap" },
+                    { "grid-template-columns", juce::String::repeatedString("1fr ", fanOut).trim() },
+                },
+            };
+
+            for (auto i = 0; i < fanOut; i++)
+                container.appendChild(createLevel(level + 1), nullptr);
+
+            return container;
+        };
+
+        auto view = createLevel(0);
+        view.setProperty("width", 1000, nullptr);
+        view.setProperty("height", 1000, nullptr);
+        return view;
+    }
+
+    /** A flex container holding `numTexts` Text items of `textLength`
+        characters each.
+    */
+    [[nodiscard]] inline juce::ValueTree createTextView(int numTexts, int textLength)
+    {
+        juce::ValueTree view{
+            "Component",
+            {
+                { "width", 1000 },
+                { "height", 1000 },
+                { "flex-wrap", "wrap" },
+            },
+        };
+
+        const auto text = createText(textLength);
+
+        for (auto i = 0; i < numTexts; i++)
+        {
+            view.appendChild(juce::ValueTree{
+                                 "Text",
+                                 {
+                                     { "text", text },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        return view;
+    }
+
+    /** A style object with `numRules` rules, drawn from the selector mix.
+        Id and class selectors are the bare names "item-<n>" and "class-<n>",
+        which createStyledView() assigns to its children.
+    */
+    [[nodiscard]] inline jive::Object::ReferenceCountedPointer createStyle(int numRules, SelectorMix mix = {})
+    {
+        static const juce::StringArray properties{ "background", "foreground", "border-width", "border-radius", "letter-spacing", "font-size" };
+        static const juce::StringArray states{ "hover", "active", "disabled", "focus" };
+
+        const auto createValue = [](const juce::String& property, int index) -> juce::var {
+            if (property == "background" || property == "foreground")
+                return createColour(index);
+
+            return index % 10 + 1;
+        };
+
+        const auto total = juce::jmax(1, mix.properties + mix.states + mix.ids + mix.classes + mix.nested);
+        jive::Object::ReferenceCountedPointer style{ new jive::Object{} };
+
+        for (auto i = 0; i < numRules; i++)
+        {
+            const auto& property = properties[i % properties.size()];
+            const auto& state = states[i % states.size()];
+            const auto value = createValue(property, i);
+            const auto slot = i % total;
+
+            if (slot < mix.properties)
+            {
+                style->setProperty(property, value);
+                continue;
+            }
+
+            jive::Object::ReferenceCountedPointer rule{ new jive::Object{ { property, value } } };
+
+            if (slot < mix.properties + mix.states)
+            {
+                // Rules for the same state merge into that state's block
+                if (auto* const existing = dynamic_cast<jive::Object*>(style->getProperty(state).getDynamicObject()))
+                    existing->setProperty(property, value);
+                else
+                    style->setProperty(state, rule.get());
+            }
+            else if (slot < mix.properties + mix.states + mix.ids)
+            {
+                style->setProperty("item-" + juce::String{ i }, rule.get());
+            }
+            else if (slot < mix.properties + mix.states + mix.ids + mix.classes)
+            {
+                style->setProperty("class-" + juce::String{ i }, rule.get());
+            }
+            else
+            {
+                style->setProperty("class-" + juce::String{ i },
+                                   new jive::Object{ { state, rule.get() } });
+            }
+        }
+
+        return style;
+    }
+
+    /** A flex container with `numChildren` children styled by `numRules`
+        rules. Every child has an id and a class that some rules select.
+    */
+    [[nodiscard]] inline juce::ValueTree createStyledView(int numChildren, int numRules, SelectorMix mix = {})
+    {
+        juce::ValueTree view{
+            "Component",
+            {
+                { "width", 1000 },
+                { "height", 1000 },
+                { "flex-wrap", "wrap" },
+                { "style", createStyle(numRules, mix).get() },
+            },
+        };
+
+        for (auto i = 0; i < numChildren; i++)
+        {
+            view.appendChild(juce::ValueTree{
+                                 "Component",
+                                 {
+                                     { "id", "item-" + juce::String{ i % juce::jmax(1, numRules) } },
+                                     { "class", "class-" + juce::String{ i % juce::jmax(1, numRules) } },
+                                     { "width", 20 },
+                                     { "height", 20 },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        return view;
+    }
+
+    /** Returns true if the child of a one-rule view from createStyledView()
+        is styled by that rule, e.g. to check that id or class rules really
+        select the generated items before timing them.
+    */
+    [[nodiscard]] inline bool resolvesSelectors(SelectorMix mix)
+    {
+        const auto view = createStyledView(1, 1, mix);
+
+        juce::Component parent;
+        juce::Component child;
+        parent.addChildComponent(child);
+
+        const auto parentStyleSheet = jive::StyleSheet::create(parent, view);
+        const auto childStyleSheet = jive::StyleSheet::create(child, view.getChild(0));
+
+        // The first rule always sets the background
+        return childStyleSheet->getBackground() == jive::Fill{ jive::parseColour(createColour(0)) };
+    }
+
+    /** A flex container with `numChildren` children that each declare
+        `numTransitions` transitions.
+    */
+    [[nodiscard]] inline juce::ValueTree createTransitionView(int numChildren, int numTransitions)
+    {
+        static const juce::StringArray properties{ "width", "height", "background", "foreground", "border-width", "opacity" };
+
+        juce::StringArray transitions;
+
+        for (auto i = 0; i < numTransitions; i++)
+        {
+            const auto suffix = i < properties.size() ? juce::String{} : "-" + juce::String{ i };
+            transitions.add(properties[i % properties.size()] + suffix + " 100ms ease-in-out");
+        }
+
+        juce::ValueTree view{
+            "Component",
+            {
+                { "width", 1000 },
+                { "height", 1000 },
+                { "flex-wrap", "wrap" },
+            },
+        };
+
+        for (auto i = 0; i < numChildren; i++)
+        {
+            view.appendChild(juce::ValueTree{
+                                 "Component",
+                                 {
+                                     { "width", 20 },
+                                     { "height", 20 },
+                                     { "transition", transitions.joinIntoString(", ") },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        return view;
+    }
+
+    /** A flex container with `numChildren` children of the given type, such
+        as "Slider" or "Button".
+    */
+    [[nodiscard]] inline juce::ValueTree createUniformView(int numChildren, const juce::Identifier& childType)
+    {
+        juce::ValueTree view{
+            "Component",
+            {
+                { "width", 1000 },
+                { "height", 1000 },
+                { "flex-wrap", "wrap" },
+            },
+        };
+
+        for (auto i = 0; i < numChildren; i++)
+        {
+            view.appendChild(juce::ValueTree{
+                                 childType,
+                                 {
+                                     { "width", 20 },
+                                     { "height", 20 },
+                                 },
+                             },
+                             nullptr);
+        }
+
+        return view;
+    }
+
+    [[nodiscard]] inline int countNodes(const juce::ValueTree& tree)
+    {
+        auto count = 1;
+
+        for (const auto& child : tree)
+            count += countNodes(child);
+
+        return count;
+    }
+} // namespace generators
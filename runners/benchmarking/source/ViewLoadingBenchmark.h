@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Benchmark.h"
+#include "ViewGenerators.h"
+
+/** Measures how long it takes to load a large view, either by parsing its XML
+    or by loading the same view compiled with jive::compileBinaryView(), as
+    the view compiler runner does.
+*/
+class ViewLoadingBenchmark : public Benchmark
+{
+public:
+    enum class Format
+    {
+        xml,
+        binary,
+    };
+
+    explicit ViewLoadingBenchmark(Format formatToLoad)
+        : Benchmark{
+            formatToLoad == Format::xml ? "Load 4369-node view - XML" : "Load 4369-node view - binary",
+            juce::RelativeTime::seconds(5.0),
+        }
+        , data{ createData(formatToLoad) }
+    {
+    }
+
+protected:
+    void doIteration(jive::Interpreter&) final
+    {
+        [[maybe_unused]] const auto view = jive::parseXML(data.getData(), static_cast<int>(data.getSize()));
+        jassert(view.isValid());
+    }
+
+private:
+    [[nodiscard]] static juce::MemoryBlock createData(Format format)
+    {
+        const auto view = generators::createNestedView(3, 16);
+
+        if (format == Format::binary)
+            return jive::compileBinaryView(view);
+
+        const auto xml = view.toXmlString();
+        return { xml.toRawUTF8(), xml.getNumBytesAsUTF8() };
+    }
+
+    const juce::MemoryBlock data;
+};
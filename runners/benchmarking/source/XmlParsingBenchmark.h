@@ -0,0 +1,121 @@
+#pragma once
+
+#include "AllocationCounting.h"
+#include "BenchmarkResult.h"
+
+/** Measures the time and peak heap usage of parsing a multi-megabyte view,
+    either with jive::parseXML()'s streaming parser or by first building a
+    juce::XmlElement DOM and converting that, as JIVE used to.
+
+    Peak memory is only measured when JIVE_INSTRUMENTATION is enabled.
+*/
+class XmlParsingBenchmark
+{
+public:
+    enum class Parser
+    {
+        streaming,
+        dom,
+    };
+
+    XmlParsingBenchmark(Parser parserToUse, int numSectionsToGenerate)
+        : parser{ parserToUse }
+        , data{ createData(numSectionsToGenerate) }
+    {
+    }
+
+    BenchmarkResult run() const
+    {
+        const auto name = juce::String{ "Parse " }
+                        + juce::String{ static_cast<double>(data.getSize()) / (1024.0 * 1024.0), 1 }
+                        + "MB view - "
+                        + (parser == Parser::streaming ? "streaming" : "DOM");
+
+        std::cout << "Parsing:    " << name << "\n\n";
+
+        std::vector<double> samples;
+        juce::int64 peakBytes = 0;
+
+        for (auto i = 0; i < numIterations; i++)
+        {
+            allocation_counting::resetPeakLiveBytes();
+
+            const auto start = juce::Time::getHighResolutionTicks();
+            [[maybe_unused]] const auto view = parse();
+            const auto end = juce::Time::getHighResolutionTicks();
+
+            jassert(view.isValid());
+            samples.push_back(juce::Time::highResolutionTicksToSeconds(end - start) * 1000.0);
+            peakBytes = juce::jmax(peakBytes, allocation_counting::getPeakLiveBytes());
+        }
+
+        auto result = BenchmarkResult::fromSamples(name, 0, std::move(samples));
+        result.counters.emplace_back("input-bytes", static_cast<double>(data.getSize()));
+
+        if (jive::Instrumentation::isEnabled)
+            result.counters.emplace_back("peak-bytes", static_cast<double>(peakBytes));
+
+        std::cout << "Mean:       " << result.meanMs << "ms\n"
+                  << "Min:        " << result.minMs << "ms\n";
+
+        for (const auto& [counterName, value] : result.counters)
+            std::cout << "    " << counterName << ": " << value << "\n";
+
+        std::cout << "\n";
+
+        return result;
+    }
+
+private:
+    [[nodiscard]] juce::ValueTree parse() const
+    {
+        const auto size = static_cast<int>(data.getSize());
+
+        if (parser == Parser::streaming)
+            return jive::parseXML(data.getData(), size);
+
+        if (const auto xml = juce::parseXML(juce::String::createStringFromData(data.getData(), size)))
+            return jive::parseXML(*xml);
+
+        return {};
+    }
+
+    // Sections of labelled controls with inline text, so that the parser's
+    // handling of text is measured as well as that of elements and attributes
+    [[nodiscard]] static juce::MemoryBlock createData(int numSections)
+    {
+        juce::MemoryOutputStream stream;
+        stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+               << "<Component width=\"800\" height=\"600\" display=\"flex\" flex-direction=\"column\">\n";
+
+        for (auto section = 0; section < numSections; section++)
+        {
+            stream << "  <Component id=\"section-" << section << "\" display=\"grid\" "
+                   << "grid-template-columns=\"1fr 2fr\" gap=\"4\" padding=\"8 12\">\n"
+                   << "    <!-- Section " << section << " -->\n";
+
+            for (auto row = 0; row < numRowsPerSection; row++)
+            {
+                stream << "    <Text id=\"label-" << section << "-" << row << "\" "
+                       << "typeface-name=\"Helvetica\" font-size=\"14\" justification=\"centred-left\">"
+                       << "Setting " << row << " &amp; its value</Text>\n"
+                       << "    <Button id=\"button-" << section << "-" << row << "\" "
+                       << "width=\"auto\" min-height=\"24\" toggleable=\"true\">\n"
+                       << "      Toggle setting " << row << "\n"
+                       << "    </Button>\n"
+                       << "    <Component flex-grow=\"1\" align-items=\"centre\" style=\"{ background: #202020; }\"/>\n";
+            }
+
+            stream << "  </Component>\n";
+        }
+
+        stream << "</Component>\n";
+        return stream.getMemoryBlock();
+    }
+
+    static constexpr auto numRowsPerSection = 16;
+    static constexpr auto numIterations = 10;
+
+    const Parser parser;
+    const juce::MemoryBlock data;
+};
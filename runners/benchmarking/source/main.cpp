@@ -1,6 +1,11 @@
+#include "BenchmarkReport.h"
 #include "FlexStressTest.h"
+#include "MemoryBenchmark.h"
 #include "MinimumViewBenchmark.h"
+#include "ScalingBenchmark.h"
 #include "StyleSheetsBenchmark.h"
+#include "ViewLoadingBenchmark.h"
+#include "XmlParsingBenchmark.h"
 
 class BenchmarkApp : public juce::JUCEApplication
 {
@@ -19,10 +24,15 @@ public:
 
     void initialise(const juce::String&) final
     {
-        StyleSheetsConstructionBenchmark{}.run();
-        StyleSheetsQueryingBenchmark{}.run();
-        MinimumViewBenchmark{}.run();
-        FlexStressTest{}.run();
+        const auto arguments = getCommandLineParameterArray();
+
+        if (arguments.contains("--help"))
+            printUsage();
+        else if (arguments.contains("--compare"))
+            compare(arguments);
+        else
+            runBenchmarks(arguments);
+
         quit();
     }
 
@@ -31,6 +41,203 @@ public:
     }
 
 private:
+    [[nodiscard]] static juce::String getOptionValue(const juce::StringArray& arguments,
+                                                     const juce::String& option,
+                                                     int offset = 1)
+    {
+        const auto index = arguments.indexOf(option);
+
+        if (index < 0)
+            return {};
+
+        return arguments[index + offset];
+    }
+
+    [[nodiscard]] static juce::File getFileForArgument(const juce::String& path)
+    {
+        return juce::File::getCurrentWorkingDirectory().getChildFile(path);
+    }
+
+    static void printUsage()
+    {
+        std::cout << "Usage:\n"
+                  << "    jive-benchmarking [--scaling] [--memory] [--parsing] [--warm-up <iterations>] [--json <file>] [--csv <file>] [--trace <file>]\n"
+                  << "    jive-benchmarking --compare <baseline.json> <current.json> [--threshold <percent>]\n";
+    }
+
+    void runBenchmarks(const juce::StringArray& arguments)
+    {
+        const auto warmUpArgument = getOptionValue(arguments, "--warm-up");
+        const auto warmUpIterations = warmUpArgument.isNotEmpty()
+                                        ? warmUpArgument.getIntValue()
+                                        : Benchmark::defaultNumWarmUpIterations;
+
+        const auto tracePath = getOptionValue(arguments, "--trace");
+
+        if (tracePath.isNotEmpty())
+            jive::Profiler::getInstance().startRecording();
+
+        BenchmarkReport report;
+        const auto run = [&report, warmUpIterations](Benchmark&& benchmark) {
+            benchmark.setNumWarmUpIterations(warmUpIterations);
+            report.add(benchmark.run());
+        };
+
+        run(StyleSheetsConstructionBenchmark{});
+        run(StyleSheetsQueryingBenchmark{});
+        run(MinimumViewBenchmark{});
+        run(FlexStressTest{});
+        run(ViewLoadingBenchmark{ ViewLoadingBenchmark::Format::xml });
+        run(ViewLoadingBenchmark{ ViewLoadingBenchmark::Format::binary });
+
+        if (arguments.contains("--scaling"))
+        {
+            // A sweep whose rules never match its items would only time the
+            // misses
+            const generators::SelectorMix idsOnly{ 0, 0, 1, 0, 0 };
+            const generators::SelectorMix classesOnly{ 0, 0, 0, 1, 0 };
+
+            if (!generators::resolvesSelectors(idsOnly) || !generators::resolvesSelectors(classesOnly))
+            {
+                std::cerr << "Generated id and class rules don't select their items\n";
+                setApplicationReturnValue(1);
+            }
+
+            runScalingSweeps(report, warmUpIterations);
+        }
+
+        if (arguments.contains("--memory"))
+            runMemoryBenchmarks(report);
+
+        if (arguments.contains("--parsing"))
+            runXmlParsingBenchmarks(report);
+
+        if (tracePath.isNotEmpty())
+        {
+            jive::Profiler::getInstance().stopRecording();
+            writeFile(getFileForArgument(tracePath), jive::Profiler::getInstance().exportChromeTrace());
+        }
+
+        for (const auto* option : { "--json", "--csv" })
+        {
+            const auto path = getOptionValue(arguments, option);
+
+            if (path.isEmpty())
+                continue;
+
+            writeFile(getFileForArgument(path),
+                      juce::String{ option } == "--csv" ? report.toCSV() : report.toJSON());
+        }
+    }
+
+    void writeFile(const juce::File& file, const juce::String& contents)
+    {
+        if (file.replaceWithText(contents))
+        {
+            std::cout << "Results written to " << file.getFullPathName() << "\n";
+        }
+        else
+        {
+            std::cerr << "Failed to write " << file.getFullPathName() << "\n";
+            setApplicationReturnValue(1);
+        }
+    }
+
+    static void runScalingSweeps(BenchmarkReport& report, int warmUpIterations)
+    {
+        using Stage = ScalingBenchmark::Stage;
+        const std::vector<int> scales{ 10, 100, 1000, 10000 };
+
+        ScalingSweep{
+            "Nested flex/grid/block containers",
+            scales,
+            [](int numNodes) {
+                const auto fanOut = juce::jmax(2, juce::roundToInt(std::cbrt(numNodes)));
+                return generators::createNestedView(3, fanOut, { 1, 1, 1 });
+            },
+            Stage::interpretation,
+        }
+            .run(report, warmUpIterations);
+        ScalingSweep{
+            "Flex layout",
+            scales,
+            [](int numChildren) {
+                return generators::createNestedView(1, numChildren);
+            },
+            Stage::layout,
+        }
+            .run(report, warmUpIterations);
+        ScalingSweep{
+            "Text nodes (L=64)",
+            scales,
+            [](int numTexts) {
+                return generators::createTextView(numTexts, 64);
+            },
+            Stage::interpretation,
+        }
+            .run(report, warmUpIterations);
+        ScalingSweep{
+            "Style rules (100 children)",
+            { 10, 100, 1000 },
+            [](int numRules) {
+                return generators::createStyledView(100, numRules);
+            },
+            Stage::interpretation,
+        }
+            .run(report, warmUpIterations);
+        ScalingSweep{
+            "Transitions (4 per child)",
+            scales,
+            [](int numChildren) {
+                return generators::createTransitionView(numChildren, 4);
+            },
+            Stage::interpretation,
+        }
+            .run(report, warmUpIterations);
+    }
+
+    static void runMemoryBenchmarks(BenchmarkReport& report)
+    {
+        static constexpr auto numItems = 1000;
+
+        report.add(MemoryBenchmark{ "Components", generators::createUniformView(numItems, "Component") }.run());
+        report.add(MemoryBenchmark{ "Sliders", generators::createUniformView(numItems, "Slider") }.run());
+        report.add(MemoryBenchmark{ "Buttons", generators::createUniformView(numItems, "Button") }.run());
+        report.add(MemoryBenchmark{ "Text", generators::createTextView(numItems, 16) }.run());
+        report.add(MemoryBenchmark{ "Nested flex/grid/block containers", generators::createNestedView(3, 10, { 1, 1, 1 }) }.run());
+    }
+
+    static void runXmlParsingBenchmarks(BenchmarkReport& report)
+    {
+        static constexpr auto numSections = 600;
+
+        report.add(XmlParsingBenchmark{ XmlParsingBenchmark::Parser::streaming, numSections }.run());
+        report.add(XmlParsingBenchmark{ XmlParsingBenchmark::Parser::dom, numSections }.run());
+    }
+
+    void compare(const juce::StringArray& arguments)
+    {
+        const auto baseline = BenchmarkReport::readFrom(getFileForArgument(getOptionValue(arguments, "--compare", 1)));
+        const auto current = BenchmarkReport::readFrom(getFileForArgument(getOptionValue(arguments, "--compare", 2)));
+
+        if (!baseline.has_value() || !current.has_value())
+        {
+            std::cerr << "Failed to read benchmark results to compare\n";
+            printUsage();
+            setApplicationReturnValue(1);
+            return;
+        }
+
+        const auto thresholdArgument = getOptionValue(arguments, "--threshold");
+        const auto threshold = thresholdArgument.isNotEmpty()
+                                 ? thresholdArgument.getDoubleValue()
+                                 : defaultRegressionThresholdPercent;
+
+        if (BenchmarkReport::compare(*baseline, *current, threshold) > 0)
+            setApplicationReturnValue(1);
+    }
+
+    static constexpr auto defaultRegressionThresholdPercent = 5.0;
 };
 
 START_JUCE_APPLICATION(BenchmarkApp)
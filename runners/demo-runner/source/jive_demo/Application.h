@@ -2,6 +2,7 @@
 
 #include "DemoState.h"
 
+#include <jive_demo/gui/DiagnosticsOverlay.h>
 #include <jive_demo/gui/WindowPresenter.h>
 #include <jive_demo/gui/tokens/Typography.h>
 #include <melatonin_inspector/melatonin_inspector.h>
@@ -28,12 +29,15 @@ namespace jive_demo
             window = interpreter.interpret(windowPresenter.present());
             interpreter.listenTo(*window);
 
+            diagnosticsOverlay = std::make_unique<DiagnosticsOverlay>(*window);
+
             inspector = std::make_unique<melatonin::Inspector>(*window->getComponent(), false);
             inspector->setVisible(true);
         }
 
         void shutdown() final
         {
+            diagnosticsOverlay = nullptr;
             window = nullptr;
             inspector = nullptr;
         }
@@ -44,6 +48,7 @@ namespace jive_demo
         jive::Interpreter interpreter;
         WindowPresenter windowPresenter{ state.getWindowState(), "Window" };
         std::unique_ptr<jive::GuiItem> window;
+        std::unique_ptr<DiagnosticsOverlay> diagnosticsOverlay;
 
         std::unique_ptr<melatonin::Inspector> inspector;
 
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <jive_layouts/jive_layouts.h>
+
+namespace jive_demo
+{
+    /** Heat-maps the items of a view by how much work they've cost since the
+        overlay was last reset, using jive::PerformanceCounters.
+
+        Press F2 to toggle the overlay. Press F3 to print the per-item counters
+        as JSON and then reset them. The keys are handled by the root's
+        top-level component, which key presses reach whichever of its children
+        has focus, and which takes focus itself when none of them do. Redder items have spent more time laying
+        out, calculating ideal sizes, applying styles, painting, and ticking
+        transitions.
+    */
+    class DiagnosticsOverlay
+        : private juce::Timer
+        , private juce::KeyListener
+        , private juce::ComponentListener
+    {
+    public:
+        explicit DiagnosticsOverlay(jive::GuiItem& rootItem)
+            : root{ rootItem }
+            , rootComponent{ *root.getComponent() }
+            , keyTarget{ *rootComponent.getTopLevelComponent() }
+            , keyTargetWantedFocus{ keyTarget.getWantsKeyboardFocus() }
+        {
+            canvas.onPaint = [this](juce::Graphics& g) {
+                paintHeatMap(g);
+            };
+            canvas.setInterceptsMouseClicks(false, false);
+            canvas.setAlwaysOnTop(true);
+            canvas.setVisible(false);
+            rootComponent.addChildComponent(canvas);
+            canvas.setBounds(rootComponent.getLocalBounds());
+
+            keyTarget.setWantsKeyboardFocus(true);
+            keyTarget.addKeyListener(this);
+            rootComponent.addComponentListener(this);
+        }
+
+        ~DiagnosticsOverlay() override
+        {
+            rootComponent.removeComponentListener(this);
+            keyTarget.removeKeyListener(this);
+            keyTarget.setWantsKeyboardFocus(keyTargetWantedFocus);
+            jive::PerformanceCounters::setEnabled(false);
+        }
+
+    private:
+        void setOverlayVisible(bool shouldBeVisible)
+        {
+            jive::PerformanceCounters::setEnabled(shouldBeVisible);
+            canvas.setVisible(shouldBeVisible);
+
+            if (shouldBeVisible)
+            {
+                jive::resetPerformanceCounters(root);
+                startTimerHz(refreshRateHz);
+            }
+            else
+            {
+                stopTimer();
+            }
+        }
+
+        bool keyPressed(const juce::KeyPress& key, juce::Component*) final
+        {
+            if (key == juce::KeyPress::F2Key)
+            {
+                setOverlayVisible(!canvas.isVisible());
+                return true;
+            }
+
+            if (key == juce::KeyPress::F3Key)
+            {
+                std::cout << juce::JSON::toString(jive::createPerformanceReport(root)) << "\n";
+                jive::resetPerformanceCounters(root);
+                canvas.repaint();
+                return true;
+            }
+
+            return false;
+        }
+
+        void componentMovedOrResized(juce::Component&, bool, bool) final
+        {
+            canvas.setBounds(rootComponent.getLocalBounds());
+        }
+
+        void timerCallback() final
+        {
+            canvas.repaint();
+        }
+
+        [[nodiscard]] static double calculateCost(const jive::PerformanceCounters& counters)
+        {
+            return counters.getLayoutMilliseconds()
+                 + 0.01 * (counters.idealSizeCalculations + counters.styleApplications + counters.paints + counters.transitionTicks);
+        }
+
+        void collectCosts(const jive::GuiItem& item, std::vector<std::pair<const jive::GuiItem*, double>>& costs) const
+        {
+            costs.emplace_back(&item, calculateCost(jive::getPerformanceCounters(item)));
+
+            for (const auto* child : item.getChildren())
+                collectCosts(*child, costs);
+        }
+
+        void paintHeatMap(juce::Graphics& g) const
+        {
+            std::vector<std::pair<const jive::GuiItem*, double>> costs;
+            collectCosts(root, costs);
+
+            const auto maxCost = std::accumulate(std::begin(costs),
+                                                 std::end(costs),
+                                                 0.0,
+                                                 [](auto max, const auto& cost) {
+                                                     return juce::jmax(max, cost.second);
+                                                 });
+
+            if (maxCost <= 0.0)
+                return;
+
+            for (const auto& [item, cost] : costs)
+            {
+                const auto component = item->getComponent();
+                const auto bounds = rootComponent.getLocalArea(component.get(), component->getLocalBounds()).toFloat();
+                const auto heat = static_cast<float>(cost / maxCost);
+
+                g.setColour(juce::Colours::blue.interpolatedWith(juce::Colours::red, heat).withAlpha(0.1f + 0.4f * heat));
+                g.fillRect(bounds);
+                g.setColour(juce::Colours::white.withAlpha(0.5f));
+                g.drawRect(bounds, 1.0f);
+            }
+        }
+
+        jive::GuiItem& root;
+        juce::Component& rootComponent;
+        juce::Component& keyTarget;
+        const bool keyTargetWantedFocus;
+        jive::Canvas canvas;
+
+        static constexpr auto refreshRateHz = 4;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DiagnosticsOverlay)
+    };
+} // namespace jive_demo
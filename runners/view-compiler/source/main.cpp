@@ -0,0 +1,102 @@
+#include <jive_core/jive_core.h>
+
+class ViewCompilerApp : public juce::JUCEApplication
+{
+public:
+    ViewCompilerApp() = default;
+
+    const juce::String getApplicationName() final
+    {
+        return "JIVE View Compiler";
+    }
+
+    const juce::String getApplicationVersion() final
+    {
+        return "1.0.0";
+    }
+
+    void initialise(const juce::String&) final
+    {
+        const auto arguments = getCommandLineParameterArray();
+
+        if (arguments.isEmpty() || arguments.contains("--help") || arguments.size() % 2 != 0)
+        {
+            printUsage();
+            setApplicationReturnValue(arguments.contains("--help") ? 0 : 1);
+        }
+        else
+        {
+            for (auto i = 0; i < arguments.size(); i += 2)
+            {
+                if (!compile(getFileForArgument(arguments[i]), getFileForArgument(arguments[i + 1])))
+                    setApplicationReturnValue(1);
+            }
+        }
+
+        quit();
+    }
+
+    void shutdown() final
+    {
+    }
+
+private:
+    [[nodiscard]] static juce::File getFileForArgument(const juce::String& path)
+    {
+        return juce::File::getCurrentWorkingDirectory().getChildFile(path);
+    }
+
+    static void printUsage()
+    {
+        std::cout << "Usage:\n"
+                  << "    jive-view-compiler <view.xml> <view.jivb> [<view.xml> <view.jivb> ...]\n\n"
+                  << "Compiles each view into the binary format read by jive::loadBinaryView().\n"
+                  << "Embed the output in place of the XML - jive::parseXML() and\n"
+                  << "jive::Interpreter::interpret() detect and load it directly.\n";
+    }
+
+    [[nodiscard]] static int countNodes(const juce::ValueTree& tree)
+    {
+        auto count = 1;
+
+        for (const auto& child : tree)
+            count += countNodes(child);
+
+        return count;
+    }
+
+    [[nodiscard]] static bool compile(const juce::File& input, const juce::File& output)
+    {
+        juce::MemoryBlock xml;
+
+        if (!input.loadFileAsData(xml))
+        {
+            std::cerr << "Failed to read " << input.getFullPathName() << "\n";
+            return false;
+        }
+
+        const auto view = jive::parseXML(xml.getData(), static_cast<int>(xml.getSize()));
+
+        if (!view.isValid())
+        {
+            std::cerr << "Failed to parse " << input.getFullPathName() << "\n";
+            return false;
+        }
+
+        const auto binary = jive::compileBinaryView(view);
+
+        if (!output.getParentDirectory().createDirectory() || !output.replaceWithData(binary.getData(), binary.getSize()))
+        {
+            std::cerr << "Failed to write " << output.getFullPathName() << "\n";
+            return false;
+        }
+
+        std::cout << input.getFileName() << " -> " << output.getFileName() << ": "
+                  << countNodes(view) << " nodes, "
+                  << xml.getSize() << " bytes -> " << binary.getSize() << " bytes\n";
+
+        return true;
+    }
+};
+
+START_JUCE_APPLICATION(ViewCompilerApp)